@@ -0,0 +1,384 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include "Vector.hpp"
+
+/**
+ * @brief Process-wide record of the sizes vectors reach, per construction site.
+ *
+ * A site is identified by a tag: an explicit string, or "file:line" of a
+ * std::source_location. For every site the registry keeps the last kWindow final
+ * sizes and derives a hint from them: by default the 90th percentile, so a
+ * vector built at that site usually fits without growing, while one unusually
+ * large run doesn't inflate every later reservation.
+ *
+ * Hints can be saved and loaded, so a restarted process starts with what the
+ * previous one learned. All member functions are thread-safe.
+ */
+class CapacityHintRegistry
+{
+public:
+    /**
+     * @brief Number of recent sizes kept per site.
+     */
+    static constexpr size_t kWindow = 32;
+
+private:
+    /**
+     * @brief Recent final sizes of one site, as a ring buffer, and the hint derived from them.
+     */
+    struct Site
+    {
+        size_t sizes[kWindow] = {};
+        size_t count = 0;
+        size_t next = 0;
+        size_t hint = 0;
+    };
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Site> m_sites;
+    double m_percentile = 0.9;
+
+    CapacityHintRegistry() = default;
+
+    /**
+     * @brief Recomputes the hint of a site from its recent sizes.
+     */
+    void update_hint(Site& site) const
+    {
+        size_t sorted[kWindow];
+        std::copy(site.sizes, site.sizes + site.count, sorted);
+        std::sort(sorted, sorted + site.count);
+        size_t rank = static_cast<size_t>(std::ceil(m_percentile * static_cast<double>(site.count)));
+        site.hint = sorted[std::clamp<size_t>(rank, 1, site.count) - 1];
+    }
+
+public:
+    CapacityHintRegistry(const CapacityHintRegistry&) = delete;
+    CapacityHintRegistry& operator=(const CapacityHintRegistry&) = delete;
+
+    /**
+     * @brief Returns the registry of the process.
+     */
+    static CapacityHintRegistry& instance()
+    {
+        static CapacityHintRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief Returns the tag used for a source location: "file:line".
+     */
+    static std::string tag_of(const std::source_location& location)
+    {
+        return std::string(location.file_name()) + ":" + std::to_string(location.line());
+    }
+
+    /**
+     * @brief Sets which percentile of the recent sizes becomes the hint.
+     *
+     * Existing hints are updated on the next record() for their site.
+     *
+     * @param percentile A value in (0, 1]; 1 means the largest recent size.
+     * @throw std::invalid_argument If the value is outside (0, 1].
+     */
+    void set_percentile(double percentile)
+    {
+        if (!(percentile > 0.0 && percentile <= 1.0))
+        {
+            throw std::invalid_argument("Percentile must be in (0, 1]");
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_percentile = percentile;
+    }
+
+    /**
+     * @brief Returns the capacity to reserve for a site, or 0 if nothing is known about it.
+     */
+    size_t hint(const std::string& tag) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_sites.find(tag);
+        return it == m_sites.end() ? 0 : it->second.hint;
+    }
+
+    /**
+     * @brief Records the final size of a vector built at a site.
+     */
+    void record(const std::string& tag, size_t size)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Site& site = m_sites[tag];
+        site.sizes[site.next] = size;
+        site.next = (site.next + 1) % kWindow;
+        site.count = std::min(site.count + 1, kWindow);
+        update_hint(site);
+    }
+
+    /**
+     * @brief Returns the number of sites with a hint.
+     */
+    size_t getSize() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_sites.size();
+    }
+
+    /**
+     * @brief Forgets all sites.
+     */
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_sites.clear();
+    }
+
+    /**
+     * @brief Writes the hints as text, one "hint tag" line per site.
+     *
+     * @param out The stream to write to.
+     */
+    void save(std::ostream& out) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& [tag, site] : m_sites)
+        {
+            out << site.hint << ' ' << tag << '\n';
+        }
+    }
+
+    /**
+     * @brief Reads hints written by save().
+     *
+     * Every loaded hint becomes the only recorded size of its site, replacing what
+     * was learned so far; later records refine it as usual.
+     *
+     * @param in The stream to read from.
+     * @return The number of hints loaded.
+     * @throw std::runtime_error If a line is malformed; hints before it stay loaded.
+     */
+    size_t load(std::istream& in)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t loaded = 0;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+            size_t space = line.find(' ');
+            if (space == 0 || space == std::string::npos || space + 1 == line.size()
+                || line.find_first_not_of("0123456789") != space)
+            {
+                throw std::runtime_error("Malformed capacity hint: " + line);
+            }
+
+            unsigned long long value;
+            try
+            {
+                value = std::stoull(line.substr(0, space));
+            }
+            catch (const std::out_of_range&)
+            {
+                throw std::runtime_error("Malformed capacity hint: " + line);
+            }
+            if (value > std::numeric_limits<size_t>::max())
+            {
+                throw std::runtime_error("Malformed capacity hint: " + line);
+            }
+
+            Site site;
+            site.sizes[0] = static_cast<size_t>(value);
+            site.count = 1;
+            site.next = 1;
+            site.hint = site.sizes[0];
+            m_sites[line.substr(space + 1)] = site;
+            ++loaded;
+        }
+        return loaded;
+    }
+};
+
+/**
+ * @brief Vector that reserves the learned capacity of its construction site and reports its final size.
+ *
+ * Constructed without arguments, the site is the line that constructs the vector.
+ * The size at destruction is recorded, so the next vector built at the same site
+ * starts with enough capacity for a typical run and doesn't reallocate while it grows.
+ *
+ * A vector without a buffer records nothing. That covers vectors whose contents were
+ * moved out, including into a plain Vector<T> (e.g. `return hinted;` from
+ * a function returning Vector<T>), so such a move doesn't record a bogus size of 0.
+ * Use take() instead to hand the contents on as a Vector<T> and still record the size.
+ * Assigning to a HintedVector records the size it had before being overwritten.
+ *
+ * @tparam T The type of elements stored in the vector.
+ */
+template<typename T>
+class HintedVector : public Vector<T>
+{
+private:
+    std::string m_tag;
+
+    /**
+     * @brief False once the contents have been moved out.
+     */
+    bool m_records;
+
+    void reserve_hint();
+
+    /**
+     * @brief Records the current size unless the vector has been moved from or never allocated.
+     */
+    void record_size() noexcept;
+
+public:
+    /**
+     * @brief Constructor for the site given by a source location.
+     *
+     * @param location Defaults to the location of the construction.
+     */
+    explicit HintedVector(const std::source_location& location = std::source_location::current());
+
+    /**
+     * @brief Constructor for a site given by an explicit tag.
+     *
+     * @param tag The name of the site; must not contain a newline.
+     */
+    explicit HintedVector(std::string tag);
+
+    HintedVector(const HintedVector& other);
+    HintedVector(HintedVector&& other) noexcept;
+    HintedVector& operator=(const HintedVector& other);
+    HintedVector& operator=(HintedVector&& other) noexcept;
+
+    /**
+     * @brief Destructor: Records the final size and frees memory.
+     */
+    ~HintedVector();
+
+    /**
+     * @brief Returns the tag of the construction site.
+     */
+    const std::string& tag() const;
+
+    /**
+     * @brief Records the current size and moves the contents out as a plain vector.
+     *
+     * The HintedVector is left empty and records nothing more.
+     */
+    Vector<T> take();
+};
+
+template <typename T>
+void HintedVector<T>::reserve_hint()
+{
+    size_t hint = CapacityHintRegistry::instance().hint(m_tag);
+    if (hint != 0)
+    {
+        this->reserve(hint);
+    }
+}
+
+template <typename T>
+HintedVector<T>::HintedVector(const std::source_location& location)
+    : m_tag(CapacityHintRegistry::tag_of(location)), m_records(true)
+{
+    reserve_hint();
+}
+
+template <typename T>
+HintedVector<T>::HintedVector(std::string tag) : m_tag(std::move(tag)), m_records(true)
+{
+    reserve_hint();
+}
+
+template <typename T>
+HintedVector<T>::HintedVector(const HintedVector& other)
+    : Vector<T>(other), m_tag(other.m_tag), m_records(true)
+{
+}
+
+template <typename T>
+HintedVector<T>::HintedVector(HintedVector&& other) noexcept
+    : Vector<T>(std::move(other)), m_tag(std::move(other.m_tag)), m_records(other.m_records)
+{
+    other.m_records = false;
+}
+
+template <typename T>
+void HintedVector<T>::record_size() noexcept
+{
+    if (!m_records || (this->data() == nullptr && this->getCapacity() == 0))
+    {
+        return;
+    }
+    try
+    {
+        CapacityHintRegistry::instance().record(m_tag, this->getSize());
+    }
+    catch (...)
+    {
+        // Recording is best effort; a destructor must not throw.
+    }
+}
+
+template <typename T>
+HintedVector<T>& HintedVector<T>::operator=(const HintedVector& other)
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+    record_size();
+    Vector<T>::operator=(other);
+    m_tag = other.m_tag;
+    m_records = true;
+    return *this;
+}
+
+template <typename T>
+HintedVector<T>& HintedVector<T>::operator=(HintedVector&& other) noexcept
+{
+    if (this == &other)
+    {
+        return *this;
+    }
+    record_size();
+    Vector<T>::operator=(std::move(other));
+    m_tag = std::move(other.m_tag);
+    m_records = other.m_records;
+    other.m_records = false;
+    return *this;
+}
+
+template <typename T>
+HintedVector<T>::~HintedVector()
+{
+    record_size();
+}
+
+template <typename T>
+const std::string& HintedVector<T>::tag() const
+{
+    return m_tag;
+}
+
+template <typename T>
+Vector<T> HintedVector<T>::take()
+{
+    record_size();
+    m_records = false;
+    return Vector<T>(std::move(static_cast<Vector<T>&>(*this)));
+}
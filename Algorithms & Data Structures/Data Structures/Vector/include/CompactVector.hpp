@@ -0,0 +1,984 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "Vector.hpp"
+
+/**
+ * @brief Dynamic array with 32-bit size and capacity fields.
+ *
+ * Works exactly like Vector, but the object itself is 16 bytes instead of 24
+ * on 64-bit platforms. Useful when many mostly-small vectors are stored inside
+ * other structures. The number of elements is limited to UINT32_MAX.
+ * Members without a description behave like their Vector counterparts.
+ *
+ * @tparam T The type of elements stored in the vector.
+ */
+template<typename T>
+class CompactVector
+{
+private:
+    /**
+     * @brief Pointer to a dynamic array: stores the elements of a vector.
+     */
+    T* m_data;
+
+    /**
+     * @brief Current size: the number of elements in the vector.
+     */
+    uint32_t m_size;
+
+    /**
+     * @brief Capacity: The number of elements that the allocated memory can hold without reallocation.
+     */
+    uint32_t m_capacity;
+
+    /**
+     * @brief Reallocates the storage to hold exactly new_capacity elements.
+     *
+     * @param new_capacity The new capacity of the vector.
+     */
+    void reallocate(size_t new_capacity);
+
+    /**
+     * @brief Returns the capacity to grow to when one more element is needed.
+     *
+     * @throw std::length_error If the vector already holds the maximum number of elements.
+     */
+    size_t grown_capacity() const;
+
+public:
+    using Iterator = typename Vector<T>::Iterator;
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /**
+     * @brief Maximum number of elements a CompactVector can hold.
+     */
+    static constexpr size_t max_size = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief Default constructor: Initializes an empty vector.
+     */
+    CompactVector();
+
+    /**
+     * @brief Constructor with parameter: allows you to set the initial capacity.
+     *
+     * @param initialCapacity The initial capacity of the vector.
+     * @throw std::length_error If initialCapacity exceeds max_size.
+     */
+    CompactVector(size_t initialCapacity);
+
+    /**
+     * @brief Copy constructor: Creates a copy of another vector.
+     *
+     * @param other The vector to copy from.
+     */
+    CompactVector(const CompactVector& other);
+
+    /**
+     * @brief Move constructor: Moves resources from another vector.
+     *
+     * @param other The vector to move from. After moving, other is empty.
+     */
+    CompactVector(CompactVector&& other) noexcept;
+
+    /**
+     * @brief Constructor for initializing a vector with elements from an initialization list.
+     *
+     * @param init_list The initializer list to initialize the vector with.
+     */
+    CompactVector(std::initializer_list<T> init_list);
+
+    /**
+     * @brief Copy assignment operator: copies data from another vector.
+     *
+     * @param other The vector to copy from.
+     * @return Reference to the current vector.
+     */
+    CompactVector& operator=(const CompactVector& other);
+
+    /**
+     * @brief Move assignment operator: Moves resources from another vector.
+     *
+     * @param other The vector to move from. After moving, other is empty.
+     * @return Reference to the current vector.
+     */
+    CompactVector& operator=(CompactVector&& other) noexcept;
+
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+
+    size_t getSize() const;
+    size_t getCapacity() const;
+    bool empty() const;
+
+    /**
+     * @brief Access to an element with bounds checking.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    T& at(size_t index);
+    const T& at(size_t index) const;
+
+    void push_back(const T& value);
+    void push_back(T&& value);
+
+    /**
+     * @brief Removes the last element.
+     *
+     * @throw std::out_of_range If the vector is empty.
+     */
+    void pop_back();
+
+    /**
+     * @brief Pre-allocation of memory for vector elements.
+     *
+     * @throw std::length_error If new_capacity exceeds max_size.
+     */
+    void reserve(size_t new_capacity);
+
+    /**
+     * @brief Changes in the number of elements in a vector.
+     *
+     * @throw std::length_error If new_size exceeds max_size.
+     */
+    void resize(size_t new_size, const T& value = T());
+
+    void shrink_to_fit();
+
+    /**
+     * @brief Clears the vector but does't free the memory.
+     */
+    void clear();
+
+    /**
+     * @brief Inserts an element at the specified position.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    void insert(size_t index, const T& value);
+
+    /**
+     * @brief Removes an element from the specified position.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    void erase(size_t index);
+
+    ~CompactVector();
+
+    Iterator begin() { return Iterator(m_data); }
+    Iterator end() { return Iterator(m_data + m_size); }
+    ConstIterator begin() const { return ConstIterator(m_data); }
+    ConstIterator end() const { return ConstIterator(m_data + m_size); }
+    ConstIterator cbegin() const { return ConstIterator(m_data); }
+    ConstIterator cend() const { return ConstIterator(m_data + m_size); }
+};
+
+/**
+ * @brief Dynamic array stored behind a single pointer.
+ *
+ * The object is 8 bytes: size and capacity live in a header placed right
+ * before the elements in the same allocation, and the pointer is null while
+ * the vector has no storage. Best suited for huge arrays of vectors where most
+ * of them stay empty. Elements are constructed only up to the current size.
+ * Members without a description behave like their Vector counterparts.
+ *
+ * @tparam T The type of elements stored in the vector.
+ */
+template<typename T>
+class ThinVector
+{
+private:
+    /**
+     * @brief Bookkeeping stored in front of the elements.
+     */
+    struct Header
+    {
+        size_t size;
+        size_t capacity;
+    };
+
+    static constexpr size_t kAlignment = alignof(T) > alignof(Header) ? alignof(T) : alignof(Header);
+    static constexpr size_t kDataOffset = (sizeof(Header) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    /**
+     * @brief Pointer to the header of the allocation, or nullptr when there is no storage.
+     */
+    Header* m_header;
+
+    T* elements() const;
+    static Header* allocate(size_t capacity);
+    static void deallocate(Header* header);
+
+    /**
+     * @brief Moves the elements into a new allocation of new_capacity elements.
+     *
+     * @param new_capacity The new capacity, must not be less than the size.
+     */
+    void reallocate(size_t new_capacity);
+
+    /**
+     * @brief Grows the storage so that one more element fits and constructs it at the end.
+     */
+    template<typename U>
+    void grow_and_append(U&& value);
+
+public:
+    using Iterator = typename Vector<T>::Iterator;
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /**
+     * @brief Default constructor: Initializes an empty vector without allocating.
+     */
+    ThinVector();
+
+    /**
+     * @brief Constructor with parameter: allows you to set the initial capacity.
+     *
+     * @param initialCapacity The initial capacity of the vector.
+     */
+    ThinVector(size_t initialCapacity);
+
+    ThinVector(const ThinVector& other);
+    ThinVector(ThinVector&& other) noexcept;
+    ThinVector(std::initializer_list<T> init_list);
+    ThinVector& operator=(const ThinVector& other);
+    ThinVector& operator=(ThinVector&& other) noexcept;
+
+    T& operator[](size_t index);
+    const T& operator[](size_t index) const;
+
+    size_t getSize() const;
+    size_t getCapacity() const;
+    bool empty() const;
+
+    /**
+     * @brief Access to an element with bounds checking.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    T& at(size_t index);
+    const T& at(size_t index) const;
+
+    void push_back(const T& value);
+    void push_back(T&& value);
+
+    /**
+     * @brief Removes and destroys the last element.
+     *
+     * @throw std::out_of_range If the vector is empty.
+     */
+    void pop_back();
+
+    void reserve(size_t new_capacity);
+    void resize(size_t new_size, const T& value = T());
+
+    /**
+     * @brief Decreasing the capacity of a vector to its current size.
+     *
+     * An empty vector releases its allocation and becomes a null pointer again.
+     */
+    void shrink_to_fit();
+
+    /**
+     * @brief Destroys all elements but does't free the memory.
+     */
+    void clear();
+
+    /**
+     * @brief Inserts an element at the specified position.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    void insert(size_t index, const T& value);
+
+    /**
+     * @brief Removes an element from the specified position.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    void erase(size_t index);
+
+    ~ThinVector();
+
+    Iterator begin() { return Iterator(elements()); }
+    Iterator end() { return Iterator(elements() + getSize()); }
+    ConstIterator begin() const { return ConstIterator(elements()); }
+    ConstIterator end() const { return ConstIterator(elements() + getSize()); }
+    ConstIterator cbegin() const { return ConstIterator(elements()); }
+    ConstIterator cend() const { return ConstIterator(elements() + getSize()); }
+};
+
+// CompactVector
+
+template <typename T>
+CompactVector<T>::CompactVector() : m_data(nullptr), m_size(0), m_capacity(0)
+{
+    // Initialize an empty vector.
+}
+
+template <typename T>
+CompactVector<T>::CompactVector(size_t initialCapacity) : m_data(nullptr), m_size(0), m_capacity(0)
+{
+    reserve(initialCapacity);
+}
+
+template <typename T>
+CompactVector<T>::CompactVector(const CompactVector& other)
+    : m_data(other.m_size ? new T[other.m_size] : nullptr), m_size(other.m_size), m_capacity(other.m_size)
+{
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        m_data[i] = other.m_data[i];
+    }
+}
+
+template <typename T>
+CompactVector<T>::CompactVector(CompactVector&& other) noexcept
+    : m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity)
+{
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_capacity = 0;
+}
+
+template <typename T>
+CompactVector<T>::CompactVector(std::initializer_list<T> init_list) : m_data(nullptr), m_size(0), m_capacity(0)
+{
+    reserve(init_list.size());
+    for (auto &&element : init_list)
+    {
+        m_data[m_size++] = element;
+    }
+}
+
+template <typename T>
+CompactVector<T>& CompactVector<T>::operator=(const CompactVector& other)
+{
+    if (this != &other)
+    {
+        if (other.m_size > m_capacity)
+        {
+            delete[] m_data;
+            m_data = new T[other.m_size];
+            m_capacity = other.m_size;
+        }
+
+        for (size_t i = 0; i < other.m_size; ++i)
+        {
+            m_data[i] = other.m_data[i];
+        }
+        m_size = other.m_size;
+    }
+    return *this;
+}
+
+template <typename T>
+CompactVector<T>& CompactVector<T>::operator=(CompactVector&& other) noexcept
+{
+    if (this != &other)
+    {
+        delete[] m_data;
+
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+    }
+    return *this;
+}
+
+template <typename T>
+T& CompactVector<T>::operator[](size_t index)
+{
+    return m_data[index];
+}
+
+template <typename T>
+const T& CompactVector<T>::operator[](size_t index) const
+{
+    return m_data[index];
+}
+
+template <typename T>
+size_t CompactVector<T>::getSize() const
+{
+    return m_size;
+}
+
+template <typename T>
+size_t CompactVector<T>::getCapacity() const
+{
+    return m_capacity;
+}
+
+template <typename T>
+bool CompactVector<T>::empty() const
+{
+    return m_size == 0;
+}
+
+template <typename T>
+T& CompactVector<T>::at(size_t index)
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+    return m_data[index];
+}
+
+template <typename T>
+const T& CompactVector<T>::at(size_t index) const
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+    return m_data[index];
+}
+
+template <typename T>
+void CompactVector<T>::reallocate(size_t new_capacity)
+{
+    T* new_data = new T[new_capacity];
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        new_data[i] = std::move(m_data[i]);
+    }
+    delete[] m_data;
+    m_data = new_data;
+    m_capacity = static_cast<uint32_t>(new_capacity);
+}
+
+template <typename T>
+size_t CompactVector<T>::grown_capacity() const
+{
+    if (m_capacity == max_size)
+    {
+        throw std::length_error("CompactVector size limit exceeded");
+    }
+    size_t doubled = (m_capacity == 0) ? 1 : static_cast<size_t>(m_capacity) * 2;
+    return doubled > max_size ? max_size : doubled;
+}
+
+template <typename T>
+void CompactVector<T>::push_back(const T& value)
+{
+    if (m_size >= m_capacity)
+    {
+        T copy = value;
+        reallocate(grown_capacity());
+        m_data[m_size++] = std::move(copy);
+        return;
+    }
+    m_data[m_size++] = value;
+}
+
+template <typename T>
+void CompactVector<T>::push_back(T&& value)
+{
+    if (m_size >= m_capacity)
+    {
+        T moved = std::move(value);
+        reallocate(grown_capacity());
+        m_data[m_size++] = std::move(moved);
+        return;
+    }
+    m_data[m_size++] = std::move(value);
+}
+
+template <typename T>
+void CompactVector<T>::pop_back()
+{
+    if (m_size == 0)
+    {
+        throw std::out_of_range("Can't pop_back from an empty vector");
+    }
+    --m_size;
+}
+
+template <typename T>
+void CompactVector<T>::reserve(size_t new_capacity)
+{
+    if (new_capacity <= m_capacity)
+    {
+        return;
+    }
+    if (new_capacity > max_size)
+    {
+        throw std::length_error("CompactVector size limit exceeded");
+    }
+    reallocate(new_capacity);
+}
+
+template <typename T>
+void CompactVector<T>::resize(size_t new_size, const T& value)
+{
+    if (new_size == m_size)
+    {
+        return;
+    }
+
+    if (new_size > m_capacity)
+    {
+        reserve(new_size);
+    }
+
+    for (size_t i = m_size; i < new_size; ++i)
+    {
+        m_data[i] = value;
+    }
+    m_size = static_cast<uint32_t>(new_size);
+}
+
+template <typename T>
+void CompactVector<T>::shrink_to_fit()
+{
+    if (m_capacity == m_size)
+    {
+        return;
+    }
+    if (m_size == 0)
+    {
+        delete[] m_data;
+        m_data = nullptr;
+        m_capacity = 0;
+        return;
+    }
+    reallocate(m_size);
+}
+
+template <typename T>
+void CompactVector<T>::clear()
+{
+    m_size = 0;
+}
+
+template <typename T>
+void CompactVector<T>::insert(size_t index, const T& value)
+{
+    if (index > m_size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    T copy = value;
+    if (m_size >= m_capacity)
+    {
+        reallocate(grown_capacity());
+    }
+
+    for (size_t i = m_size; i > index; --i)
+    {
+        m_data[i] = std::move(m_data[i - 1]);
+    }
+    m_data[index] = std::move(copy);
+    ++m_size;
+}
+
+template <typename T>
+void CompactVector<T>::erase(size_t index)
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    for (size_t i = index; i < m_size - 1u; ++i)
+    {
+        m_data[i] = std::move(m_data[i + 1]);
+    }
+    --m_size;
+}
+
+template <typename T>
+CompactVector<T>::~CompactVector()
+{
+    delete[] m_data;
+}
+
+// ThinVector
+
+template <typename T>
+T* ThinVector<T>::elements() const
+{
+    if (m_header == nullptr)
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<T*>(reinterpret_cast<char*>(m_header) + kDataOffset);
+}
+
+template <typename T>
+typename ThinVector<T>::Header* ThinVector<T>::allocate(size_t capacity)
+{
+    void* raw = ::operator new(kDataOffset + capacity * sizeof(T), std::align_val_t(kAlignment));
+    Header* header = static_cast<Header*>(raw);
+    header->size = 0;
+    header->capacity = capacity;
+    return header;
+}
+
+template <typename T>
+void ThinVector<T>::deallocate(Header* header)
+{
+    if (header != nullptr)
+    {
+        ::operator delete(header, std::align_val_t(kAlignment));
+    }
+}
+
+template <typename T>
+void ThinVector<T>::reallocate(size_t new_capacity)
+{
+    Header* new_header = allocate(new_capacity);
+    T* new_data = reinterpret_cast<T*>(reinterpret_cast<char*>(new_header) + kDataOffset);
+    T* old_data = elements();
+    size_t size = getSize();
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        new (new_data + i) T(std::move(old_data[i]));
+        old_data[i].~T();
+    }
+    new_header->size = size;
+
+    deallocate(m_header);
+    m_header = new_header;
+}
+
+template <typename T>
+template <typename U>
+void ThinVector<T>::grow_and_append(U&& value)
+{
+    size_t size = getSize();
+    size_t new_capacity = (size == 0) ? 1 : size * 2;
+
+    // Construct the new element first: value may refer to an element of this vector.
+    Header* new_header = allocate(new_capacity);
+    T* new_data = reinterpret_cast<T*>(reinterpret_cast<char*>(new_header) + kDataOffset);
+    try
+    {
+        new (new_data + size) T(std::forward<U>(value));
+    }
+    catch (...)
+    {
+        deallocate(new_header);
+        throw;
+    }
+
+    T* old_data = elements();
+    for (size_t i = 0; i < size; ++i)
+    {
+        new (new_data + i) T(std::move(old_data[i]));
+        old_data[i].~T();
+    }
+    new_header->size = size + 1;
+
+    deallocate(m_header);
+    m_header = new_header;
+}
+
+template <typename T>
+ThinVector<T>::ThinVector() : m_header(nullptr)
+{
+    // Initialize an empty vector.
+}
+
+template <typename T>
+ThinVector<T>::ThinVector(size_t initialCapacity) : m_header(nullptr)
+{
+    reserve(initialCapacity);
+}
+
+template <typename T>
+ThinVector<T>::ThinVector(const ThinVector& other) : m_header(nullptr)
+{
+    size_t size = other.getSize();
+    if (size == 0)
+    {
+        return;
+    }
+
+    m_header = allocate(size);
+    T* data = elements();
+    const T* source = other.elements();
+    try
+    {
+        for (; m_header->size < size; ++m_header->size)
+        {
+            new (data + m_header->size) T(source[m_header->size]);
+        }
+    }
+    catch (...)
+    {
+        clear();
+        deallocate(m_header);
+        throw;
+    }
+}
+
+template <typename T>
+ThinVector<T>::ThinVector(ThinVector&& other) noexcept : m_header(other.m_header)
+{
+    other.m_header = nullptr;
+}
+
+template <typename T>
+ThinVector<T>::ThinVector(std::initializer_list<T> init_list) : m_header(nullptr)
+{
+    reserve(init_list.size());
+    for (auto &&element : init_list)
+    {
+        push_back(element);
+    }
+}
+
+template <typename T>
+ThinVector<T>& ThinVector<T>::operator=(const ThinVector& other)
+{
+    if (this != &other)
+    {
+        ThinVector copy(other);
+        std::swap(m_header, copy.m_header);
+    }
+    return *this;
+}
+
+template <typename T>
+ThinVector<T>& ThinVector<T>::operator=(ThinVector&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        deallocate(m_header);
+        m_header = other.m_header;
+        other.m_header = nullptr;
+    }
+    return *this;
+}
+
+template <typename T>
+T& ThinVector<T>::operator[](size_t index)
+{
+    return elements()[index];
+}
+
+template <typename T>
+const T& ThinVector<T>::operator[](size_t index) const
+{
+    return elements()[index];
+}
+
+template <typename T>
+size_t ThinVector<T>::getSize() const
+{
+    return m_header ? m_header->size : 0;
+}
+
+template <typename T>
+size_t ThinVector<T>::getCapacity() const
+{
+    return m_header ? m_header->capacity : 0;
+}
+
+template <typename T>
+bool ThinVector<T>::empty() const
+{
+    return getSize() == 0;
+}
+
+template <typename T>
+T& ThinVector<T>::at(size_t index)
+{
+    if (index >= getSize())
+    {
+        throw std::out_of_range("Index out of range");
+    }
+    return elements()[index];
+}
+
+template <typename T>
+const T& ThinVector<T>::at(size_t index) const
+{
+    if (index >= getSize())
+    {
+        throw std::out_of_range("Index out of range");
+    }
+    return elements()[index];
+}
+
+template <typename T>
+void ThinVector<T>::push_back(const T& value)
+{
+    if (getSize() >= getCapacity())
+    {
+        grow_and_append(value);
+        return;
+    }
+    new (elements() + m_header->size) T(value);
+    ++m_header->size;
+}
+
+template <typename T>
+void ThinVector<T>::push_back(T&& value)
+{
+    if (getSize() >= getCapacity())
+    {
+        grow_and_append(std::move(value));
+        return;
+    }
+    new (elements() + m_header->size) T(std::move(value));
+    ++m_header->size;
+}
+
+template <typename T>
+void ThinVector<T>::pop_back()
+{
+    if (getSize() == 0)
+    {
+        throw std::out_of_range("Can't pop_back from an empty vector");
+    }
+    --m_header->size;
+    elements()[m_header->size].~T();
+}
+
+template <typename T>
+void ThinVector<T>::reserve(size_t new_capacity)
+{
+    if (new_capacity <= getCapacity())
+    {
+        return;
+    }
+    reallocate(new_capacity);
+}
+
+template <typename T>
+void ThinVector<T>::resize(size_t new_size, const T& value)
+{
+    size_t size = getSize();
+    if (new_size == size)
+    {
+        return;
+    }
+
+    if (new_size < size)
+    {
+        T* data = elements();
+        for (size_t i = new_size; i < size; ++i)
+        {
+            data[i].~T();
+        }
+        m_header->size = new_size;
+        return;
+    }
+
+    if (new_size > getCapacity())
+    {
+        T copy = value;
+        reserve(new_size);
+        for (T* data = elements(); m_header->size < new_size; ++m_header->size)
+        {
+            new (data + m_header->size) T(copy);
+        }
+        return;
+    }
+
+    for (T* data = elements(); m_header->size < new_size; ++m_header->size)
+    {
+        new (data + m_header->size) T(value);
+    }
+}
+
+template <typename T>
+void ThinVector<T>::shrink_to_fit()
+{
+    if (getCapacity() == getSize())
+    {
+        return;
+    }
+    if (getSize() == 0)
+    {
+        deallocate(m_header);
+        m_header = nullptr;
+        return;
+    }
+    reallocate(getSize());
+}
+
+template <typename T>
+void ThinVector<T>::clear()
+{
+    if (m_header == nullptr)
+    {
+        return;
+    }
+    T* data = elements();
+    for (size_t i = 0; i < m_header->size; ++i)
+    {
+        data[i].~T();
+    }
+    m_header->size = 0;
+}
+
+template <typename T>
+void ThinVector<T>::insert(size_t index, const T& value)
+{
+    size_t size = getSize();
+    if (index > size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+    if (index == size)
+    {
+        push_back(value);
+        return;
+    }
+
+    T copy = value;
+    if (size >= getCapacity())
+    {
+        reallocate(size * 2);
+    }
+
+    T* data = elements();
+    new (data + size) T(std::move(data[size - 1]));
+    ++m_header->size;
+    for (size_t i = size - 1; i > index; --i)
+    {
+        data[i] = std::move(data[i - 1]);
+    }
+    data[index] = std::move(copy);
+}
+
+template <typename T>
+void ThinVector<T>::erase(size_t index)
+{
+    size_t size = getSize();
+    if (index >= size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    T* data = elements();
+    for (size_t i = index; i < size - 1; ++i)
+    {
+        data[i] = std::move(data[i + 1]);
+    }
+    pop_back();
+}
+
+template <typename T>
+ThinVector<T>::~ThinVector()
+{
+    clear();
+    deallocate(m_header);
+}
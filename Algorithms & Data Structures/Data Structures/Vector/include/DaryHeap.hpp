@@ -0,0 +1,782 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "Vector.hpp"
+
+namespace dary_detail
+{
+    constexpr size_t kCacheLine = 64;
+
+    /**
+     * @brief Growable array of heap nodes whose buffer starts on a cache-line boundary.
+     *
+     * Vector allocates with new T[], which only guarantees the alignment of T (16
+     * bytes at most from the default allocator), so a sibling group can straddle two
+     * cache lines. This buffer is allocated with operator new(std::align_val_t) like
+     * ThinVector's, and only [0, size) holds live objects.
+     */
+    template<typename T>
+    class AlignedStorage
+    {
+    private:
+        static constexpr size_t kAlignment = alignof(T) > kCacheLine ? alignof(T) : kCacheLine;
+
+        T* m_data = nullptr;
+        size_t m_size = 0;
+        size_t m_capacity = 0;
+
+        static T* allocate(size_t capacity)
+        {
+            return static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t(kAlignment)));
+        }
+
+        static void deallocate(T* data)
+        {
+            if (data != nullptr)
+            {
+                ::operator delete(data, std::align_val_t(kAlignment));
+            }
+        }
+
+        /**
+         * @brief Moves the elements into a buffer of new_capacity >= size elements.
+         */
+        void reallocate(size_t new_capacity)
+        {
+            T* new_data = allocate(new_capacity);
+            for (size_t i = 0; i < m_size; ++i)
+            {
+                new (new_data + i) T(std::move(m_data[i]));
+                m_data[i].~T();
+            }
+            deallocate(m_data);
+            m_data = new_data;
+            m_capacity = new_capacity;
+        }
+
+        template<typename U>
+        void append(U&& value)
+        {
+            if (m_size == m_capacity)
+            {
+                // Copy first: value may refer to an element of this buffer.
+                T copy(std::forward<U>(value));
+                reallocate(m_capacity == 0 ? 16 : m_capacity * 2);
+                new (m_data + m_size) T(std::move(copy));
+            }
+            else
+            {
+                new (m_data + m_size) T(std::forward<U>(value));
+            }
+            ++m_size;
+        }
+
+    public:
+        AlignedStorage() = default;
+
+        AlignedStorage(const AlignedStorage& other)
+        {
+            reserve(other.m_size);
+            for (size_t i = 0; i < other.m_size; ++i)
+            {
+                push_back(other.m_data[i]);
+            }
+        }
+
+        AlignedStorage(AlignedStorage&& other) noexcept
+            : m_data(other.m_data), m_size(other.m_size), m_capacity(other.m_capacity)
+        {
+            other.m_data = nullptr;
+            other.m_size = 0;
+            other.m_capacity = 0;
+        }
+
+        AlignedStorage& operator=(AlignedStorage other) noexcept
+        {
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+            std::swap(m_capacity, other.m_capacity);
+            return *this;
+        }
+
+        ~AlignedStorage()
+        {
+            clear();
+            deallocate(m_data);
+        }
+
+        size_t getSize() const { return m_size; }
+        const T* data() const { return m_data; }
+        T& operator[](size_t index) { return m_data[index]; }
+        const T& operator[](size_t index) const { return m_data[index]; }
+
+        void reserve(size_t new_capacity)
+        {
+            if (new_capacity > m_capacity)
+            {
+                reallocate(new_capacity);
+            }
+        }
+
+        void push_back(const T& value) { append(value); }
+        void push_back(T&& value) { append(std::move(value)); }
+
+        void pop_back()
+        {
+            m_data[--m_size].~T();
+        }
+
+        /**
+         * @brief Shrinks to new_size elements or appends default-constructed ones.
+         */
+        void resize(size_t new_size)
+        {
+            while (m_size > new_size)
+            {
+                pop_back();
+            }
+            reserve(new_size);
+            while (m_size < new_size)
+            {
+                new (m_data + m_size) T();
+                ++m_size;
+            }
+        }
+
+        void clear()
+        {
+            resize(0);
+        }
+    };
+}
+
+/**
+ * @brief Priority queue stored as a D-ary heap in a Vector.
+ *
+ * Compared with a binary heap, a 4- or 8-ary heap is half or a third as deep,
+ * so pop() follows fewer parent-child links, and all children of a node are
+ * next to each other in memory. The storage is allocated on a 64-byte boundary
+ * and starts with D - 1 unused slots, which shifts the nodes so that every group
+ * of siblings begins at a multiple of D elements. When D * sizeof(T) divides 64
+ * (for example D = 8 with 8-byte T, or D = 4 with 16-byte T), the children
+ * compared by one sift-down step therefore lie in a single cache line. For other
+ * sizes groups may still cross a line boundary.
+ *
+ * Like std::priority_queue, Compare(a, b) returns true if a has lower priority
+ * than b, so the default std::less gives a max-heap and std::greater a min-heap.
+ *
+ * @tparam T The type of elements stored in the heap.
+ * @tparam D The number of children per node: 2, 4 or 8.
+ * @tparam Compare The priority comparison.
+ */
+template<typename T, size_t D = 4, typename Compare = std::less<T>>
+class DaryHeap
+{
+    static_assert(D == 2 || D == 4 || D == 8, "DaryHeap supports D = 2, 4 or 8");
+
+private:
+    /**
+     * @brief Number of unused slots in front of the root.
+     */
+    static constexpr size_t kOffset = D - 1;
+
+    /**
+     * @brief Padding slots followed by the heap nodes in level order.
+     */
+    dary_detail::AlignedStorage<T> m_data;
+
+    Compare m_compare;
+
+    T& node(size_t index) { return m_data[index + kOffset]; }
+    const T& node(size_t index) const { return m_data[index + kOffset]; }
+
+    void sift_up(size_t index);
+    void sift_down(size_t index);
+
+    /**
+     * @brief Restores the heap property for all nodes in O(n).
+     */
+    void heapify();
+
+public:
+    /**
+     * @brief Constructor: Initializes an empty heap.
+     *
+     * @param compare The priority comparison.
+     */
+    explicit DaryHeap(Compare compare = Compare());
+
+    /**
+     * @brief Constructor that builds a heap from existing values in O(n).
+     *
+     * @param values The values to store.
+     * @param compare The priority comparison.
+     */
+    explicit DaryHeap(const Vector<T>& values, Compare compare = Compare());
+
+    /**
+     * @brief Returns the number of elements in the heap.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Checks if the heap is empty.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the element with the highest priority.
+     *
+     * @throw std::out_of_range If the heap is empty.
+     */
+    const T& top() const;
+
+    /**
+     * @brief Adds an element.
+     *
+     * @param value The value to be added.
+     */
+    void push(const T& value);
+
+    /**
+     * @brief Adds an element using move semantics.
+     *
+     * @param value The value to be added.
+     */
+    void push(T&& value);
+
+    /**
+     * @brief Adds many elements at once.
+     *
+     * When the batch is large compared to the heap, the whole heap is rebuilt in
+     * O(n + k) instead of sifting every new element up.
+     *
+     * @param values The values to be added.
+     */
+    void push_bulk(const Vector<T>& values);
+
+    /**
+     * @brief Removes the element with the highest priority.
+     *
+     * @throw std::out_of_range If the heap is empty.
+     */
+    void pop();
+
+    /**
+     * @brief Removes the element with the highest priority and returns it.
+     *
+     * @throw std::out_of_range If the heap is empty.
+     */
+    T pop_top();
+
+    /**
+     * @brief Replaces the contents with the given values and rebuilds the heap in O(n).
+     *
+     * @param values The values to store.
+     */
+    void make_heap(const Vector<T>& values);
+
+    /**
+     * @brief Pre-allocation of memory for heap elements.
+     */
+    void reserve(size_t new_capacity);
+
+    /**
+     * @brief Removes all elements but doesn't free the memory.
+     */
+    void clear();
+};
+
+/**
+ * @brief D-ary heap of integer ids with priorities that supports decrease_key().
+ *
+ * Every id in [0, n) can be in the heap at most once. A position map from ids to
+ * heap nodes lets the priority of a queued id be changed in O(log_D n), which is
+ * what Dijkstra-style schedulers need. The layout of the nodes is the same as in
+ * DaryHeap; a node holds a priority and an id, so with 8-byte priorities D = 4
+ * puts each sibling group in one cache line.
+ *
+ * @tparam Priority The type of priorities.
+ * @tparam D The number of children per node: 2, 4 or 8.
+ * @tparam Compare The priority comparison, see DaryHeap.
+ */
+template<typename Priority, size_t D = 4, typename Compare = std::less<Priority>>
+class IndexedDaryHeap
+{
+    static_assert(D == 2 || D == 4 || D == 8, "IndexedDaryHeap supports D = 2, 4 or 8");
+
+public:
+    /**
+     * @brief Marks ids that are not in the heap in the position map.
+     */
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+private:
+    struct Node
+    {
+        Priority priority;
+        size_t id;
+    };
+
+    static constexpr size_t kOffset = D - 1;
+
+    dary_detail::AlignedStorage<Node> m_nodes;
+
+    /**
+     * @brief For every id, its position in the heap or npos.
+     */
+    Vector<size_t> m_position;
+
+    size_t m_size;
+    Compare m_compare;
+
+    Node& node(size_t index) { return m_nodes[index + kOffset]; }
+    const Node& node(size_t index) const { return m_nodes[index + kOffset]; }
+
+    void place(size_t index, Node&& value)
+    {
+        m_position[value.id] = index;
+        node(index) = std::move(value);
+    }
+
+    void sift_up(size_t index);
+    void sift_down(size_t index);
+
+public:
+    /**
+     * @brief Constructor: Initializes an empty heap.
+     *
+     * @param compare The priority comparison.
+     */
+    explicit IndexedDaryHeap(Compare compare = Compare());
+
+    size_t getSize() const;
+    bool empty() const;
+
+    /**
+     * @brief Checks if an id is in the heap.
+     */
+    bool contains(size_t id) const;
+
+    /**
+     * @brief Returns the priority of a queued id.
+     *
+     * @throw std::out_of_range If the id is not in the heap.
+     */
+    const Priority& priority(size_t id) const;
+
+    /**
+     * @brief Returns the id with the highest priority.
+     *
+     * @throw std::out_of_range If the heap is empty.
+     */
+    size_t top_id() const;
+
+    /**
+     * @brief Returns the highest priority in the heap.
+     *
+     * @throw std::out_of_range If the heap is empty.
+     */
+    const Priority& top_priority() const;
+
+    /**
+     * @brief Adds an id with a priority.
+     *
+     * @throw std::invalid_argument If the id is already in the heap.
+     */
+    void push(size_t id, const Priority& priority);
+
+    /**
+     * @brief Removes the id with the highest priority and returns it.
+     *
+     * @throw std::out_of_range If the heap is empty.
+     */
+    size_t pop();
+
+    /**
+     * @brief Moves a queued id towards the top by giving it a higher priority.
+     *
+     * For a min-heap (Compare = std::greater) this lowers the key.
+     *
+     * @param id The id to update.
+     * @param priority The new priority.
+     * @throw std::out_of_range If the id is not in the heap.
+     * @throw std::invalid_argument If the new priority is lower than the current one.
+     */
+    void decrease_key(size_t id, const Priority& priority);
+
+    /**
+     * @brief Removes all ids but doesn't free the memory.
+     */
+    void clear();
+};
+
+// DaryHeap
+
+template <typename T, size_t D, typename Compare>
+DaryHeap<T, D, Compare>::DaryHeap(Compare compare) : m_compare(std::move(compare))
+{
+    m_data.resize(kOffset);
+}
+
+template <typename T, size_t D, typename Compare>
+DaryHeap<T, D, Compare>::DaryHeap(const Vector<T>& values, Compare compare) : m_compare(std::move(compare))
+{
+    make_heap(values);
+}
+
+template <typename T, size_t D, typename Compare>
+size_t DaryHeap<T, D, Compare>::getSize() const
+{
+    return m_data.getSize() - kOffset;
+}
+
+template <typename T, size_t D, typename Compare>
+bool DaryHeap<T, D, Compare>::empty() const
+{
+    return getSize() == 0;
+}
+
+template <typename T, size_t D, typename Compare>
+const T& DaryHeap<T, D, Compare>::top() const
+{
+    if (empty())
+    {
+        throw std::out_of_range("Can't get top of an empty heap");
+    }
+    return node(0);
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::sift_up(size_t index)
+{
+    T value = std::move(node(index));
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / D;
+        if (!m_compare(node(parent), value))
+        {
+            break;
+        }
+        node(index) = std::move(node(parent));
+        index = parent;
+    }
+    node(index) = std::move(value);
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::sift_down(size_t index)
+{
+    size_t size = getSize();
+    T value = std::move(node(index));
+    while (true)
+    {
+        size_t first = index * D + 1;
+        if (first >= size)
+        {
+            break;
+        }
+
+        size_t last = first + D < size ? first + D : size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; ++child)
+        {
+            if (m_compare(node(best), node(child)))
+            {
+                best = child;
+            }
+        }
+
+        if (!m_compare(value, node(best)))
+        {
+            break;
+        }
+        node(index) = std::move(node(best));
+        index = best;
+    }
+    node(index) = std::move(value);
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::heapify()
+{
+    size_t size = getSize();
+    if (size < 2)
+    {
+        return;
+    }
+    for (size_t index = (size - 2) / D + 1; index-- > 0;)
+    {
+        sift_down(index);
+    }
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::push(const T& value)
+{
+    m_data.push_back(value);
+    sift_up(getSize() - 1);
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::push(T&& value)
+{
+    m_data.push_back(std::move(value));
+    sift_up(getSize() - 1);
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::push_bulk(const Vector<T>& values)
+{
+    size_t old_size = getSize();
+    m_data.reserve(m_data.getSize() + values.getSize());
+    for (size_t i = 0; i < values.getSize(); ++i)
+    {
+        m_data.push_back(values[i]);
+    }
+
+    // Sifting k elements up costs about k * log_D(n); a rebuild costs about n + k.
+    if (values.getSize() * 4 >= old_size)
+    {
+        heapify();
+        return;
+    }
+    for (size_t i = old_size; i < getSize(); ++i)
+    {
+        sift_up(i);
+    }
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::pop()
+{
+    if (empty())
+    {
+        throw std::out_of_range("Can't pop from an empty heap");
+    }
+
+    size_t last = getSize() - 1;
+    if (last != 0)
+    {
+        node(0) = std::move(node(last));
+    }
+    m_data.pop_back();
+    if (!empty())
+    {
+        sift_down(0);
+    }
+}
+
+template <typename T, size_t D, typename Compare>
+T DaryHeap<T, D, Compare>::pop_top()
+{
+    if (empty())
+    {
+        throw std::out_of_range("Can't pop from an empty heap");
+    }
+    T result = std::move(node(0));
+    pop();
+    return result;
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::make_heap(const Vector<T>& values)
+{
+    m_data.clear();
+    m_data.reserve(values.getSize() + kOffset);
+    m_data.resize(kOffset);
+    for (size_t i = 0; i < values.getSize(); ++i)
+    {
+        m_data.push_back(values[i]);
+    }
+    heapify();
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::reserve(size_t new_capacity)
+{
+    m_data.reserve(new_capacity + kOffset);
+}
+
+template <typename T, size_t D, typename Compare>
+void DaryHeap<T, D, Compare>::clear()
+{
+    m_data.resize(kOffset);
+}
+
+// IndexedDaryHeap
+
+template <typename Priority, size_t D, typename Compare>
+IndexedDaryHeap<Priority, D, Compare>::IndexedDaryHeap(Compare compare) : m_size(0), m_compare(std::move(compare))
+{
+    m_nodes.resize(kOffset);
+}
+
+template <typename Priority, size_t D, typename Compare>
+size_t IndexedDaryHeap<Priority, D, Compare>::getSize() const
+{
+    return m_size;
+}
+
+template <typename Priority, size_t D, typename Compare>
+bool IndexedDaryHeap<Priority, D, Compare>::empty() const
+{
+    return m_size == 0;
+}
+
+template <typename Priority, size_t D, typename Compare>
+bool IndexedDaryHeap<Priority, D, Compare>::contains(size_t id) const
+{
+    return id < m_position.getSize() && m_position[id] != npos;
+}
+
+template <typename Priority, size_t D, typename Compare>
+const Priority& IndexedDaryHeap<Priority, D, Compare>::priority(size_t id) const
+{
+    if (!contains(id))
+    {
+        throw std::out_of_range("Id is not in the heap");
+    }
+    return node(m_position[id]).priority;
+}
+
+template <typename Priority, size_t D, typename Compare>
+size_t IndexedDaryHeap<Priority, D, Compare>::top_id() const
+{
+    if (empty())
+    {
+        throw std::out_of_range("Can't get top of an empty heap");
+    }
+    return node(0).id;
+}
+
+template <typename Priority, size_t D, typename Compare>
+const Priority& IndexedDaryHeap<Priority, D, Compare>::top_priority() const
+{
+    if (empty())
+    {
+        throw std::out_of_range("Can't get top of an empty heap");
+    }
+    return node(0).priority;
+}
+
+template <typename Priority, size_t D, typename Compare>
+void IndexedDaryHeap<Priority, D, Compare>::sift_up(size_t index)
+{
+    Node value = std::move(node(index));
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / D;
+        if (!m_compare(node(parent).priority, value.priority))
+        {
+            break;
+        }
+        place(index, std::move(node(parent)));
+        index = parent;
+    }
+    place(index, std::move(value));
+}
+
+template <typename Priority, size_t D, typename Compare>
+void IndexedDaryHeap<Priority, D, Compare>::sift_down(size_t index)
+{
+    Node value = std::move(node(index));
+    while (true)
+    {
+        size_t first = index * D + 1;
+        if (first >= m_size)
+        {
+            break;
+        }
+
+        size_t last = first + D < m_size ? first + D : m_size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; ++child)
+        {
+            if (m_compare(node(best).priority, node(child).priority))
+            {
+                best = child;
+            }
+        }
+
+        if (!m_compare(value.priority, node(best).priority))
+        {
+            break;
+        }
+        place(index, std::move(node(best)));
+        index = best;
+    }
+    place(index, std::move(value));
+}
+
+template <typename Priority, size_t D, typename Compare>
+void IndexedDaryHeap<Priority, D, Compare>::push(size_t id, const Priority& priority)
+{
+    if (contains(id))
+    {
+        throw std::invalid_argument("Id is already in the heap");
+    }
+    if (id >= m_position.getSize())
+    {
+        m_position.resize(id + 1, npos);
+    }
+
+    m_nodes.push_back(Node{priority, id});
+    m_position[id] = m_size;
+    ++m_size;
+    sift_up(m_size - 1);
+}
+
+template <typename Priority, size_t D, typename Compare>
+size_t IndexedDaryHeap<Priority, D, Compare>::pop()
+{
+    if (empty())
+    {
+        throw std::out_of_range("Can't pop from an empty heap");
+    }
+
+    size_t id = node(0).id;
+    m_position[id] = npos;
+    --m_size;
+    if (m_size != 0)
+    {
+        place(0, std::move(node(m_size)));
+    }
+    m_nodes.pop_back();
+    if (m_size != 0)
+    {
+        sift_down(0);
+    }
+    return id;
+}
+
+template <typename Priority, size_t D, typename Compare>
+void IndexedDaryHeap<Priority, D, Compare>::decrease_key(size_t id, const Priority& priority)
+{
+    if (!contains(id))
+    {
+        throw std::out_of_range("Id is not in the heap");
+    }
+
+    size_t index = m_position[id];
+    if (m_compare(priority, node(index).priority))
+    {
+        throw std::invalid_argument("New priority is lower than the current one");
+    }
+    node(index).priority = priority;
+    sift_up(index);
+}
+
+template <typename Priority, size_t D, typename Compare>
+void IndexedDaryHeap<Priority, D, Compare>::clear()
+{
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        m_position[node(i).id] = npos;
+    }
+    m_nodes.resize(kOffset);
+    m_size = 0;
+}
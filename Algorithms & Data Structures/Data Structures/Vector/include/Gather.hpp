@@ -0,0 +1,348 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "Parallel.hpp"
+#include "Vector.hpp"
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#define GATHER_USE_AVX512 1
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#define GATHER_USE_AVX2 1
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GATHER_PREFETCH_READ(address) __builtin_prefetch((address), 0, 3)
+#define GATHER_PREFETCH_WRITE(address) __builtin_prefetch((address), 1, 3)
+#elif defined(_MSC_VER)
+#include <xmmintrin.h>
+#define GATHER_PREFETCH_READ(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#define GATHER_PREFETCH_WRITE(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#else
+#define GATHER_PREFETCH_READ(address) ((void)(address))
+#define GATHER_PREFETCH_WRITE(address) ((void)(address))
+#endif
+
+/**
+ * @file Gather.hpp
+ * @brief Indexed reads and writes over large vectors: gather, scatter and scatter_add.
+ *
+ * Random accesses into a vector much larger than the cache wait on memory one at a
+ * time when written as a plain loop over operator[]. These functions look ahead in
+ * the index vector and prefetch the elements that will be needed prefetch_distance
+ * positions later, so many cache misses are in flight at once.
+ *
+ * When compiled with AVX2 or AVX-512, gather() of 4- and 8-byte trivially copyable
+ * types uses the hardware gather instructions.
+ *
+ * Indices are not checked: every index must be less than the size of the vector it
+ * refers to.
+ */
+
+/**
+ * @brief Tuning parameters for gather(), scatter() and scatter_add().
+ */
+struct GatherOptions
+{
+    /**
+     * @brief How many positions ahead in the index vector to prefetch; 0 disables prefetching.
+     *
+     * Enough to cover memory latency is usually 8 to 64; the best value depends on the
+     * machine and on how much work is done per element.
+     */
+    size_t prefetch_distance = 16;
+
+    /**
+     * @brief Number of threads, each taking a contiguous chunk of the indices; 0 means default_thread_count().
+     */
+    size_t thread_count = 1;
+};
+
+namespace gather_detail
+{
+    /**
+     * @brief Below this number of indices the work is done on the calling thread.
+     */
+    constexpr size_t kParallelThreshold = 1 << 15;
+
+    inline size_t threads_for(size_t count, const GatherOptions& options)
+    {
+        return count < kParallelThreshold ? 1 : options.thread_count;
+    }
+
+    /**
+     * @brief True if the hardware gather can load T elements with Index indices.
+     */
+    template<typename T, typename Index>
+    constexpr bool simd_gather_v = std::is_trivially_copyable_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)
+        && std::is_integral_v<Index> && (sizeof(Index) == 4 || sizeof(Index) == 8);
+
+    template<typename T, typename Index>
+    void prefetch_block(const T* source, const Index* indices, size_t from, size_t to)
+    {
+        for (size_t k = from; k < to; ++k)
+        {
+            GATHER_PREFETCH_READ(source + indices[k]);
+        }
+    }
+
+#if defined(GATHER_USE_AVX512) || defined(GATHER_USE_AVX2)
+    /**
+     * @brief Gathers a prefix of [begin, end) with SIMD and returns where the scalar loop should continue.
+     */
+    template<typename T, typename Index>
+    size_t simd_gather(const T* source, const Index* indices, T* out, size_t begin, size_t end, size_t distance)
+    {
+        constexpr int kScale = static_cast<int>(sizeof(T));
+        const void* base = source;
+        size_t i = begin;
+
+#if defined(GATHER_USE_AVX512)
+        if constexpr (sizeof(T) == 4 && sizeof(Index) == 4)
+        {
+            for (; i + 16 <= end; i += 16)
+            {
+                if (distance != 0 && i + distance + 16 <= end)
+                {
+                    prefetch_block(source, indices, i + distance, i + distance + 16);
+                }
+                __m512i idx = _mm512_loadu_si512(indices + i);
+                _mm512_storeu_si512(out + i, _mm512_i32gather_epi32(idx, base, kScale));
+            }
+        }
+        else if constexpr (sizeof(T) == 8 && sizeof(Index) == 4)
+        {
+            for (; i + 8 <= end; i += 8)
+            {
+                if (distance != 0 && i + distance + 8 <= end)
+                {
+                    prefetch_block(source, indices, i + distance, i + distance + 8);
+                }
+                __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                _mm512_storeu_si512(out + i, _mm512_i32gather_epi64(idx, base, kScale));
+            }
+        }
+        else if constexpr (sizeof(T) == 4 && sizeof(Index) == 8)
+        {
+            for (; i + 8 <= end; i += 8)
+            {
+                if (distance != 0 && i + distance + 8 <= end)
+                {
+                    prefetch_block(source, indices, i + distance, i + distance + 8);
+                }
+                __m512i idx = _mm512_loadu_si512(indices + i);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm512_i64gather_epi32(idx, base, kScale));
+            }
+        }
+        else
+        {
+            for (; i + 8 <= end; i += 8)
+            {
+                if (distance != 0 && i + distance + 8 <= end)
+                {
+                    prefetch_block(source, indices, i + distance, i + distance + 8);
+                }
+                __m512i idx = _mm512_loadu_si512(indices + i);
+                _mm512_storeu_si512(out + i, _mm512_i64gather_epi64(idx, base, kScale));
+            }
+        }
+#else
+        const int* base32 = static_cast<const int*>(base);
+        const long long* base64 = static_cast<const long long*>(base);
+        if constexpr (sizeof(T) == 4 && sizeof(Index) == 4)
+        {
+            for (; i + 8 <= end; i += 8)
+            {
+                if (distance != 0 && i + distance + 8 <= end)
+                {
+                    prefetch_block(source, indices, i + distance, i + distance + 8);
+                }
+                __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_i32gather_epi32(base32, idx, kScale));
+            }
+        }
+        else if constexpr (sizeof(T) == 8 && sizeof(Index) == 4)
+        {
+            for (; i + 4 <= end; i += 4)
+            {
+                if (distance != 0 && i + distance + 4 <= end)
+                {
+                    prefetch_block(source, indices, i + distance, i + distance + 4);
+                }
+                __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_i32gather_epi64(base64, idx, kScale));
+            }
+        }
+        else if constexpr (sizeof(T) == 4 && sizeof(Index) == 8)
+        {
+            for (; i + 4 <= end; i += 4)
+            {
+                if (distance != 0 && i + distance + 4 <= end)
+                {
+                    prefetch_block(source, indices, i + distance, i + distance + 4);
+                }
+                __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_i64gather_epi32(base32, idx, kScale));
+            }
+        }
+        else
+        {
+            for (; i + 4 <= end; i += 4)
+            {
+                if (distance != 0 && i + distance + 4 <= end)
+                {
+                    prefetch_block(source, indices, i + distance, i + distance + 4);
+                }
+                __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_i64gather_epi64(base64, idx, kScale));
+            }
+        }
+#endif
+        return i;
+    }
+#endif
+
+    template<typename T, typename Index>
+    void gather_range(const T* source, size_t source_size, const Index* indices, T* out,
+                      size_t begin, size_t end, size_t distance)
+    {
+        size_t i = begin;
+
+#if defined(GATHER_USE_AVX512) || defined(GATHER_USE_AVX2)
+        if constexpr (simd_gather_v<T, Index>)
+        {
+            // The gather instructions read 32-bit indices as signed.
+            if (sizeof(Index) == 8 || source_size <= static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+            {
+                i = simd_gather(source, indices, out, begin, end, distance);
+            }
+        }
+#endif
+        (void)source_size;
+
+        if (distance != 0)
+        {
+            for (; i + distance < end; ++i)
+            {
+                GATHER_PREFETCH_READ(source + indices[i + distance]);
+                out[i] = source[indices[i]];
+            }
+        }
+        for (; i < end; ++i)
+        {
+            out[i] = source[indices[i]];
+        }
+    }
+}
+
+/**
+ * @brief Reads source elements by index: out[i] = source[indices[i]].
+ *
+ * @param source The vector to read from.
+ * @param indices Positions in source, each less than source.getSize().
+ * @param out Receives the values; resized to indices.getSize(). Must not be source.
+ * @param options Prefetch distance and number of threads.
+ */
+template<typename T, typename Index>
+void gather(const Vector<T>& source, const Vector<Index>& indices, Vector<T>& out,
+            const GatherOptions& options = GatherOptions())
+{
+    size_t count = indices.getSize();
+    out.resize(count);
+
+    const T* source_data = source.data();
+    const Index* index_data = indices.data();
+    T* out_data = out.data();
+    size_t source_size = source.getSize();
+    parallel_for(0, count, gather_detail::threads_for(count, options), [&](size_t begin, size_t end, size_t) {
+        gather_detail::gather_range(source_data, source_size, index_data, out_data, begin, end,
+                                    options.prefetch_distance);
+    });
+}
+
+/**
+ * @brief Writes values by index: destination[indices[i]] = values[i].
+ *
+ * With one thread, later values win when an index repeats. With more threads the
+ * indices must be unique, because chunks are written concurrently.
+ *
+ * @param values The values to write.
+ * @param indices Positions in destination, one per value, each less than destination.getSize().
+ * @param destination The vector to write into. Its size doesn't change.
+ * @param options Prefetch distance and number of threads.
+ * @throw std::invalid_argument If values and indices have different sizes.
+ */
+template<typename T, typename Index>
+void scatter(const Vector<T>& values, const Vector<Index>& indices, Vector<T>& destination,
+             const GatherOptions& options = GatherOptions())
+{
+    size_t count = indices.getSize();
+    if (values.getSize() != count)
+    {
+        throw std::invalid_argument("Vector sizes don't match");
+    }
+
+    const T* value_data = values.data();
+    const Index* index_data = indices.data();
+    T* target = destination.data();
+    size_t distance = options.prefetch_distance;
+    parallel_for(0, count, gather_detail::threads_for(count, options), [&](size_t begin, size_t end, size_t) {
+        size_t i = begin;
+        if (distance != 0)
+        {
+            for (; i + distance < end; ++i)
+            {
+                GATHER_PREFETCH_WRITE(target + index_data[i + distance]);
+                target[index_data[i]] = value_data[i];
+            }
+        }
+        for (; i < end; ++i)
+        {
+            target[index_data[i]] = value_data[i];
+        }
+    });
+}
+
+/**
+ * @brief Accumulates values by index: destination[indices[i]] += values[i].
+ *
+ * Always runs on the calling thread, since repeated indices would make concurrent
+ * additions race; options.thread_count is ignored.
+ *
+ * @param values The values to add.
+ * @param indices Positions in destination, one per value, each less than destination.getSize().
+ * @param destination The vector to add into. Its size doesn't change.
+ * @param options Prefetch distance.
+ * @throw std::invalid_argument If values and indices have different sizes.
+ */
+template<typename T, typename Index>
+void scatter_add(const Vector<T>& values, const Vector<Index>& indices, Vector<T>& destination,
+                 const GatherOptions& options = GatherOptions())
+{
+    size_t count = indices.getSize();
+    if (values.getSize() != count)
+    {
+        throw std::invalid_argument("Vector sizes don't match");
+    }
+
+    const T* value_data = values.data();
+    const Index* index_data = indices.data();
+    T* target = destination.data();
+    size_t distance = options.prefetch_distance;
+    size_t i = 0;
+    if (distance != 0)
+    {
+        for (; i + distance < count; ++i)
+        {
+            GATHER_PREFETCH_WRITE(target + index_data[i + distance]);
+            target[index_data[i]] += value_data[i];
+        }
+    }
+    for (; i < count; ++i)
+    {
+        target[index_data[i]] += value_data[i];
+    }
+}
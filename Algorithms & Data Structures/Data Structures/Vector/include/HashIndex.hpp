@@ -0,0 +1,324 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include "Vector.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HASH_INDEX_USE_SSE2 1
+#endif
+
+/**
+ * @brief Open-addressing hash table that maps hashes to element indices.
+ *
+ * The table does not know anything about the elements: it only stores their
+ * indices, and the owner supplies the hash and an equality check for every
+ * lookup. This keeps it usable as a secondary index over data held in a Vector.
+ *
+ * The layout follows the SwissTable design: every slot has one control byte
+ * holding either a marker (empty / deleted) or the low 7 bits of the hash.
+ * Lookups compare a whole group of 16 control bytes at once (with SSE2 when
+ * available) and only touch the slots whose control byte matches.
+ */
+class HashIndex
+{
+public:
+    /**
+     * @brief Returned by find() when nothing matches.
+     */
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+private:
+    static constexpr size_t kGroupWidth = 16;
+    static constexpr size_t kMinCapacity = 16;
+    static constexpr int8_t kEmpty = -128;
+    static constexpr int8_t kDeleted = -2;
+
+    /**
+     * @brief Control bytes: capacity entries plus kGroupWidth - 1 mirrored bytes at the end,
+     *        so that a group starting near the end can be loaded without wrapping around.
+     */
+    Vector<int8_t> m_control;
+
+    /**
+     * @brief Stored indices, one per slot.
+     */
+    Vector<size_t> m_slots;
+
+    /**
+     * @brief Number of slots, always zero or a power of two.
+     */
+    size_t m_capacity;
+
+    /**
+     * @brief Number of stored indices.
+     */
+    size_t m_size;
+
+    /**
+     * @brief Number of slots marked as deleted.
+     */
+    size_t m_deleted;
+
+    static size_t mix(size_t hash)
+    {
+        uint64_t h = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(h ^ (h >> 32));
+    }
+
+    static size_t h1(size_t mixed) { return mixed >> 7; }
+    static int8_t h2(size_t mixed) { return static_cast<int8_t>(mixed & 0x7F); }
+
+    /**
+     * @brief Returns a bit mask of the group positions whose control byte equals value.
+     */
+    static uint32_t match(const int8_t* group, int8_t value)
+    {
+#ifdef HASH_INDEX_USE_SSE2
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value))));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; ++i)
+        {
+            mask |= static_cast<uint32_t>(group[i] == value) << i;
+        }
+        return mask;
+#endif
+    }
+
+    /**
+     * @brief Returns a bit mask of the group positions that are empty or deleted.
+     *
+     * Both markers are negative while full slots are not, so this is the sign bit of every byte.
+     */
+    static uint32_t match_free(const int8_t* group)
+    {
+#ifdef HASH_INDEX_USE_SSE2
+        __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32_t>(_mm_movemask_epi8(ctrl));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < kGroupWidth; ++i)
+        {
+            mask |= static_cast<uint32_t>(group[i] < 0) << i;
+        }
+        return mask;
+#endif
+    }
+
+    static unsigned lowest_bit(uint32_t mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+        unsigned bit = 0;
+        while ((mask & 1u) == 0)
+        {
+            mask >>= 1;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    void set_control(size_t pos, int8_t value)
+    {
+        m_control[pos] = value;
+        if (pos < kGroupWidth - 1)
+        {
+            m_control[m_capacity + pos] = value;
+        }
+    }
+
+    /**
+     * @brief Finds the first empty or deleted slot on the probe sequence of a hash.
+     */
+    size_t find_free(size_t mixed) const
+    {
+        size_t mask = m_capacity - 1;
+        size_t pos = h1(mixed) & mask;
+        for (size_t step = kGroupWidth;; step += kGroupWidth)
+        {
+            uint32_t free = match_free(m_control.data() + pos);
+            if (free != 0)
+            {
+                return (pos + lowest_bit(free)) & mask;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    /**
+     * @brief Rebuilds the table with new_capacity slots, dropping all deleted markers.
+     */
+    template<typename HashOf>
+    void rehash(size_t new_capacity, HashOf&& hash_of)
+    {
+        Vector<size_t> old_values;
+        old_values.reserve(m_size);
+        for (size_t i = 0; i < m_capacity; ++i)
+        {
+            if (m_control[i] >= 0)
+            {
+                old_values.push_back(m_slots[i]);
+            }
+        }
+
+        m_capacity = new_capacity;
+        m_control.clear();
+        m_control.resize(m_capacity + kGroupWidth - 1, kEmpty);
+        m_slots.clear();
+        m_slots.resize(m_capacity);
+        m_deleted = 0;
+
+        for (size_t i = 0; i < old_values.getSize(); ++i)
+        {
+            size_t mixed = mix(hash_of(old_values[i]));
+            size_t pos = find_free(mixed);
+            set_control(pos, h2(mixed));
+            m_slots[pos] = old_values[i];
+        }
+    }
+
+public:
+    /**
+     * @brief Default constructor: Initializes an empty index without allocating.
+     */
+    HashIndex() : m_capacity(0), m_size(0), m_deleted(0) {}
+
+    /**
+     * @brief Returns the number of stored indices.
+     */
+    size_t getSize() const { return m_size; }
+
+    /**
+     * @brief Returns the number of slots.
+     */
+    size_t getCapacity() const { return m_capacity; }
+
+    /**
+     * @brief Looks up a slot whose stored index satisfies the equality check.
+     *
+     * @param hash The hash of the key being searched for.
+     * @param equal Callable taking a stored index and returning true if it refers to the key.
+     * @return The slot position, or npos if there is no such entry.
+     */
+    template<typename Equal>
+    size_t find(size_t hash, Equal&& equal) const
+    {
+        if (m_size == 0)
+        {
+            return npos;
+        }
+
+        size_t mixed = mix(hash);
+        int8_t tag = h2(mixed);
+        size_t mask = m_capacity - 1;
+        size_t pos = h1(mixed) & mask;
+        for (size_t step = kGroupWidth; step <= m_capacity + kGroupWidth; step += kGroupWidth)
+        {
+            const int8_t* group = m_control.data() + pos;
+            for (uint32_t candidates = match(group, tag); candidates != 0; candidates &= candidates - 1)
+            {
+                size_t slot = (pos + lowest_bit(candidates)) & mask;
+                if (equal(m_slots[slot]))
+                {
+                    return slot;
+                }
+            }
+            if (match(group, kEmpty) != 0)
+            {
+                return npos;
+            }
+            pos = (pos + step) & mask;
+        }
+        return npos;
+    }
+
+    /**
+     * @brief Returns the index stored in a slot returned by find().
+     */
+    size_t value(size_t slot) const { return m_slots[slot]; }
+
+    /**
+     * @brief Replaces the index stored in a slot returned by find(). The hash must stay the same.
+     */
+    void set_value(size_t slot, size_t value) { m_slots[slot] = value; }
+
+    /**
+     * @brief Adds an index. The caller must make sure no equal entry is already stored.
+     *
+     * @param hash The hash of the element's key.
+     * @param value The index to store.
+     * @param hash_of Callable returning the hash for a stored index, used when the table grows.
+     */
+    template<typename HashOf>
+    void insert(size_t hash, size_t value, HashOf&& hash_of)
+    {
+        if ((m_size + m_deleted + 1) * 8 > m_capacity * 7)
+        {
+            // Grow when live entries fill more than half of the allowed load,
+            // otherwise rebuild in place to get rid of deleted markers.
+            size_t new_capacity = m_capacity == 0 ? kMinCapacity : m_capacity;
+            while ((m_size + 1) * 16 > new_capacity * 7)
+            {
+                new_capacity *= 2;
+            }
+            rehash(new_capacity, hash_of);
+        }
+
+        size_t mixed = mix(hash);
+        size_t pos = find_free(mixed);
+        if (m_control[pos] == kDeleted)
+        {
+            --m_deleted;
+        }
+        set_control(pos, h2(mixed));
+        m_slots[pos] = value;
+        ++m_size;
+    }
+
+    /**
+     * @brief Removes the entry in a slot returned by find().
+     */
+    void erase_slot(size_t slot)
+    {
+        set_control(slot, kDeleted);
+        --m_size;
+        ++m_deleted;
+    }
+
+    /**
+     * @brief Makes room for count entries without further rehashing.
+     *
+     * @param count The number of entries to reserve space for.
+     * @param hash_of Callable returning the hash for a stored index.
+     */
+    template<typename HashOf>
+    void reserve(size_t count, HashOf&& hash_of)
+    {
+        size_t new_capacity = m_capacity == 0 ? kMinCapacity : m_capacity;
+        while (count * 8 > new_capacity * 7)
+        {
+            new_capacity *= 2;
+        }
+        if (new_capacity > m_capacity)
+        {
+            rehash(new_capacity, hash_of);
+        }
+    }
+
+    /**
+     * @brief Removes all entries but keeps the slots.
+     */
+    void clear()
+    {
+        if (m_capacity != 0)
+        {
+            std::memset(m_control.data(), static_cast<unsigned char>(kEmpty), m_control.getSize());
+        }
+        m_size = 0;
+        m_deleted = 0;
+    }
+};
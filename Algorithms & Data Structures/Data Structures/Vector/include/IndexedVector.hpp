@@ -0,0 +1,323 @@
+#pragma once
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "HashIndex.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Vector with a hash index for lookups by key.
+ *
+ * Elements are kept contiguously in a Vector in insertion order, and a HashIndex
+ * maps every key to the position of its element. The index stores positions, not
+ * pointers, so it stays valid when the Vector reallocates. Keys must be unique
+ * and must not be changed while the element is stored.
+ *
+ * @tparam T The type of elements stored in the vector.
+ * @tparam KeyFn Callable (or member pointer) that extracts the key from an element.
+ * @tparam Hash Hash function for the key type.
+ */
+template<typename T, typename KeyFn, typename Hash = std::hash<std::decay_t<std::invoke_result_t<KeyFn, const T&>>>>
+class IndexedVector
+{
+public:
+    /**
+     * @brief The type of the key extracted from the elements.
+     */
+    using Key = std::decay_t<std::invoke_result_t<KeyFn, const T&>>;
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /**
+     * @brief Returned by index_of() when the key is not present.
+     */
+    static constexpr size_t npos = HashIndex::npos;
+
+private:
+    /**
+     * @brief Elements in insertion order.
+     */
+    Vector<T> m_items;
+
+    /**
+     * @brief Maps keys to positions in m_items.
+     */
+    HashIndex m_index;
+
+    KeyFn m_key;
+    Hash m_hash;
+
+    size_t hash_at(size_t position) const
+    {
+        return m_hash(std::invoke(m_key, m_items[position]));
+    }
+
+    size_t find_slot(const Key& key) const
+    {
+        return m_index.find(m_hash(key), [&](size_t position) {
+            return std::invoke(m_key, m_items[position]) == key;
+        });
+    }
+
+    size_t find_slot_of_position(size_t position) const
+    {
+        return m_index.find(hash_at(position), [&](size_t stored) { return stored == position; });
+    }
+
+    /**
+     * @brief Adds the last element of m_items to the index, removing it again if its key is taken.
+     */
+    void index_last();
+
+public:
+    /**
+     * @brief Constructor: Initializes an empty vector.
+     *
+     * @param key_fn The key extractor.
+     * @param hash The hash function for keys.
+     */
+    explicit IndexedVector(KeyFn key_fn = KeyFn(), Hash hash = Hash());
+
+    /**
+     * @brief Const index access operator.
+     *
+     * Only const access is provided, so keys can't be modified behind the index.
+     *
+     * @param index The position of the element.
+     */
+    const T& operator[](size_t index) const;
+
+    /**
+     * @brief Access to an element by position with bounds checking.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    const T& at(size_t index) const;
+
+    size_t getSize() const;
+    bool empty() const;
+
+    /**
+     * @brief Adds an element to the end of the vector.
+     *
+     * @param value The value to be added.
+     * @throw std::invalid_argument If an element with the same key is already stored.
+     */
+    void push_back(const T& value);
+
+    /**
+     * @brief Adds an element to the end of the vector using move semantics.
+     *
+     * @param value The value to be added.
+     * @throw std::invalid_argument If an element with the same key is already stored.
+     */
+    void push_back(T&& value);
+
+    /**
+     * @brief Returns the position of the element with the given key.
+     *
+     * @param key The key to look up.
+     * @return The position, or npos if there is no such element.
+     */
+    size_t index_of(const Key& key) const;
+
+    /**
+     * @brief Checks if an element with the given key is stored.
+     */
+    bool contains(const Key& key) const;
+
+    /**
+     * @brief Looks up an element by key.
+     *
+     * The key of the returned element must not be modified.
+     *
+     * @param key The key to look up.
+     * @return Pointer to the element, or nullptr if there is no such element.
+     */
+    T* find(const Key& key);
+
+    /**
+     * @brief Const version find().
+     */
+    const T* find(const Key& key) const;
+
+    /**
+     * @brief Access to an element by key.
+     *
+     * @throw std::out_of_range If there is no element with this key.
+     */
+    const T& at_key(const Key& key) const;
+
+    /**
+     * @brief Removes an element by moving the last element into its position.
+     *
+     * O(1), but changes the position of the last element.
+     *
+     * @param index The position of the element to be removed.
+     * @throw std::out_of_range If the index is out of range.
+     */
+    void swap_erase(size_t index);
+
+    /**
+     * @brief Removes the element with the given key using swap_erase().
+     *
+     * @return True if an element was removed.
+     */
+    bool erase_key(const Key& key);
+
+    /**
+     * @brief Pre-allocation of memory for the elements and the index.
+     */
+    void reserve(size_t new_capacity);
+
+    /**
+     * @brief Removes all elements but doesn't free the memory.
+     */
+    void clear();
+
+    ConstIterator begin() const { return m_items.begin(); }
+    ConstIterator end() const { return m_items.end(); }
+    ConstIterator cbegin() const { return m_items.cbegin(); }
+    ConstIterator cend() const { return m_items.cend(); }
+};
+
+template <typename T, typename KeyFn, typename Hash>
+IndexedVector<T, KeyFn, Hash>::IndexedVector(KeyFn key_fn, Hash hash)
+    : m_key(std::move(key_fn)), m_hash(std::move(hash))
+{
+    // Initialize an empty vector.
+}
+
+template <typename T, typename KeyFn, typename Hash>
+const T& IndexedVector<T, KeyFn, Hash>::operator[](size_t index) const
+{
+    return m_items[index];
+}
+
+template <typename T, typename KeyFn, typename Hash>
+const T& IndexedVector<T, KeyFn, Hash>::at(size_t index) const
+{
+    return m_items.at(index);
+}
+
+template <typename T, typename KeyFn, typename Hash>
+size_t IndexedVector<T, KeyFn, Hash>::getSize() const
+{
+    return m_items.getSize();
+}
+
+template <typename T, typename KeyFn, typename Hash>
+bool IndexedVector<T, KeyFn, Hash>::empty() const
+{
+    return m_items.empty();
+}
+
+template <typename T, typename KeyFn, typename Hash>
+void IndexedVector<T, KeyFn, Hash>::index_last()
+{
+    size_t position = m_items.getSize() - 1;
+    const Key& key = std::invoke(m_key, m_items[position]);
+    if (find_slot(key) != npos)
+    {
+        m_items.pop_back();
+        throw std::invalid_argument("Duplicate key");
+    }
+    m_index.insert(m_hash(key), position, [this](size_t stored) { return hash_at(stored); });
+}
+
+template <typename T, typename KeyFn, typename Hash>
+void IndexedVector<T, KeyFn, Hash>::push_back(const T& value)
+{
+    m_items.push_back(value);
+    index_last();
+}
+
+template <typename T, typename KeyFn, typename Hash>
+void IndexedVector<T, KeyFn, Hash>::push_back(T&& value)
+{
+    m_items.push_back(std::move(value));
+    index_last();
+}
+
+template <typename T, typename KeyFn, typename Hash>
+size_t IndexedVector<T, KeyFn, Hash>::index_of(const Key& key) const
+{
+    size_t slot = find_slot(key);
+    return slot == npos ? npos : m_index.value(slot);
+}
+
+template <typename T, typename KeyFn, typename Hash>
+bool IndexedVector<T, KeyFn, Hash>::contains(const Key& key) const
+{
+    return find_slot(key) != npos;
+}
+
+template <typename T, typename KeyFn, typename Hash>
+T* IndexedVector<T, KeyFn, Hash>::find(const Key& key)
+{
+    size_t position = index_of(key);
+    return position == npos ? nullptr : &m_items[position];
+}
+
+template <typename T, typename KeyFn, typename Hash>
+const T* IndexedVector<T, KeyFn, Hash>::find(const Key& key) const
+{
+    size_t position = index_of(key);
+    return position == npos ? nullptr : &m_items[position];
+}
+
+template <typename T, typename KeyFn, typename Hash>
+const T& IndexedVector<T, KeyFn, Hash>::at_key(const Key& key) const
+{
+    const T* item = find(key);
+    if (item == nullptr)
+    {
+        throw std::out_of_range("Key not found");
+    }
+    return *item;
+}
+
+template <typename T, typename KeyFn, typename Hash>
+void IndexedVector<T, KeyFn, Hash>::swap_erase(size_t index)
+{
+    if (index >= m_items.getSize())
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    m_index.erase_slot(find_slot_of_position(index));
+
+    size_t last = m_items.getSize() - 1;
+    if (index != last)
+    {
+        m_index.set_value(find_slot_of_position(last), index);
+        m_items[index] = std::move(m_items[last]);
+    }
+    m_items.pop_back();
+}
+
+template <typename T, typename KeyFn, typename Hash>
+bool IndexedVector<T, KeyFn, Hash>::erase_key(const Key& key)
+{
+    size_t position = index_of(key);
+    if (position == npos)
+    {
+        return false;
+    }
+    swap_erase(position);
+    return true;
+}
+
+template <typename T, typename KeyFn, typename Hash>
+void IndexedVector<T, KeyFn, Hash>::reserve(size_t new_capacity)
+{
+    m_items.reserve(new_capacity);
+    m_index.reserve(new_capacity, [this](size_t stored) { return hash_at(stored); });
+}
+
+template <typename T, typename KeyFn, typename Hash>
+void IndexedVector<T, KeyFn, Hash>::clear()
+{
+    m_items.clear();
+    m_index.clear();
+}
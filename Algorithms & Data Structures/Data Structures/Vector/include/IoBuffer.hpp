@@ -0,0 +1,228 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include "Vector.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <system_error>
+#include <sys/uio.h>
+#include <unistd.h>
+#define IO_BUFFER_USE_POSIX 1
+#endif
+
+/**
+ * @file IoBuffer.hpp
+ * @brief Reading and writing file descriptors directly into and out of byte vectors.
+ *
+ * append_from_fd() reads into the spare capacity past the last element and then
+ * extends the size with Vector::resize_for_overwrite(), so the bytes are neither
+ * zero-filled first nor copied afterwards. writev_to_fd() hands several vectors to
+ * the kernel in one system call instead of concatenating them.
+ *
+ * Available on POSIX systems only.
+ */
+
+/**
+ * @brief Outcome of a read.
+ */
+struct IoResult
+{
+    /**
+     * @brief The number of bytes transferred.
+     */
+    size_t bytes = 0;
+
+    /**
+     * @brief The descriptor reported end of file.
+     */
+    bool end_of_file = false;
+
+    /**
+     * @brief A non-blocking descriptor had nothing to read.
+     */
+    bool would_block = false;
+};
+
+namespace io_detail
+{
+    /**
+     * @brief True for the one-byte element types a vector may use as an I/O buffer.
+     */
+    template<typename T>
+    constexpr bool byte_like_v = sizeof(T) == 1 && std::is_trivially_copyable_v<T>;
+
+    inline bool would_block(int error)
+    {
+#if defined(IO_BUFFER_USE_POSIX)
+        return error == EAGAIN || error == EWOULDBLOCK;
+#else
+        (void)error;
+        return false;
+#endif
+    }
+}
+
+#if defined(IO_BUFFER_USE_POSIX)
+
+/**
+ * @brief Reads at most max_bytes from a descriptor and appends them to a vector.
+ *
+ * Makes room for max_bytes past the current size, growing the capacity at least
+ * twofold so a loop of reads doesn't reallocate every time, and issues a single
+ * read(2), retried if interrupted by a signal.
+ *
+ * @param buffer The vector to append to.
+ * @param fd The descriptor to read from.
+ * @param max_bytes The largest number of bytes to read.
+ * @return The number of bytes appended, and whether the read hit end of file or would block.
+ * @throw std::system_error If read(2) fails for any other reason; the vector is unchanged.
+ */
+template<typename T>
+IoResult append_from_fd(Vector<T>& buffer, int fd, size_t max_bytes)
+{
+    static_assert(io_detail::byte_like_v<T>, "append_from_fd needs a vector of one-byte elements");
+
+    IoResult result;
+    if (max_bytes == 0)
+    {
+        return result;
+    }
+
+    size_t size = buffer.getSize();
+    if (buffer.getCapacity() - size < max_bytes)
+    {
+        buffer.reserve(std::max(size + max_bytes, buffer.getCapacity() * 2));
+    }
+
+    ssize_t count;
+    do
+    {
+        count = ::read(fd, buffer.data() + size, max_bytes);
+    } while (count < 0 && errno == EINTR);
+
+    if (count < 0)
+    {
+        if (io_detail::would_block(errno))
+        {
+            result.would_block = true;
+            return result;
+        }
+        throw std::system_error(errno, std::generic_category(), "read");
+    }
+
+    result.bytes = static_cast<size_t>(count);
+    result.end_of_file = count == 0;
+    buffer.resize_for_overwrite(size + result.bytes);
+    return result;
+}
+
+/**
+ * @brief Writes bytes of a vector to a descriptor, starting at an offset.
+ *
+ * Keeps writing until everything is written or a non-blocking descriptor is full.
+ *
+ * @param fd The descriptor to write to.
+ * @param buffer The vector to write.
+ * @param offset The first byte to write.
+ * @return The number of bytes written; less than getSize() - offset only if the descriptor would block.
+ * @throw std::out_of_range If the offset is past the end of the vector.
+ * @throw std::system_error If write(2) fails for another reason.
+ */
+template<typename T>
+size_t write_to_fd(int fd, const Vector<T>& buffer, size_t offset = 0)
+{
+    static_assert(io_detail::byte_like_v<T>, "write_to_fd needs a vector of one-byte elements");
+
+    if (offset > buffer.getSize())
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    size_t written = 0;
+    size_t remaining = buffer.getSize() - offset;
+    while (remaining > 0)
+    {
+        ssize_t count = ::write(fd, buffer.data() + offset + written, remaining);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (io_detail::would_block(errno))
+            {
+                break;
+            }
+            throw std::system_error(errno, std::generic_category(), "write");
+        }
+        written += static_cast<size_t>(count);
+        remaining -= static_cast<size_t>(count);
+    }
+    return written;
+}
+
+/**
+ * @brief Writes several vectors to a descriptor, in order, with writev(2).
+ *
+ * Partial writes are continued from where they stopped, so normally the whole
+ * data goes out in one system call and never more than a few.
+ *
+ * @param fd The descriptor to write to.
+ * @param buffers The vectors to write; all must have one-byte elements.
+ * @return The total number of bytes written; less than the total size only if the descriptor would block.
+ * @throw std::system_error If writev(2) fails for another reason.
+ */
+template<typename... Buffers>
+size_t writev_to_fd(int fd, const Buffers&... buffers)
+{
+    static_assert(sizeof...(Buffers) > 0, "writev_to_fd needs at least one buffer");
+    static_assert((io_detail::byte_like_v<std::remove_pointer_t<decltype(buffers.data())>> && ...),
+                  "writev_to_fd needs vectors of one-byte elements");
+
+    iovec parts[sizeof...(Buffers)] = {
+        iovec{const_cast<void*>(static_cast<const void*>(buffers.data())), buffers.getSize()}...};
+    size_t first = 0;
+    size_t written = 0;
+    while (first < sizeof...(Buffers))
+    {
+        if (parts[first].iov_len == 0)
+        {
+            ++first;
+            continue;
+        }
+
+        ssize_t count = ::writev(fd, parts + first, static_cast<int>(sizeof...(Buffers) - first));
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (io_detail::would_block(errno))
+            {
+                break;
+            }
+            throw std::system_error(errno, std::generic_category(), "writev");
+        }
+
+        written += static_cast<size_t>(count);
+        size_t advance = static_cast<size_t>(count);
+        while (advance > 0)
+        {
+            size_t step = std::min(advance, parts[first].iov_len);
+            parts[first].iov_base = static_cast<char*>(parts[first].iov_base) + step;
+            parts[first].iov_len -= step;
+            advance -= step;
+            if (parts[first].iov_len == 0)
+            {
+                ++first;
+            }
+        }
+    }
+    return written;
+}
+
+#endif
@@ -0,0 +1,371 @@
+#pragma once
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include "Vector.hpp"
+
+/**
+ * @brief Vector of variable-length rows stored in CSR (compressed sparse row) layout.
+ *
+ * All values live in one contiguous buffer and an offsets array marks where each
+ * row starts, so the whole structure needs two allocations instead of one per row,
+ * and iterating rows in order streams through memory sequentially.
+ *
+ * Row i occupies values [offsets[i], offsets[i + 1]). The offsets array always
+ * holds getRowCount() + 1 entries and starts with 0.
+ *
+ * @tparam T The type of elements stored in the rows.
+ */
+template<typename T>
+class JaggedVector
+{
+private:
+    /**
+     * @brief Values of all rows, stored one row after another.
+     */
+    Vector<T> m_values;
+
+    /**
+     * @brief Start of each row in m_values, plus the total number of values at the end.
+     */
+    Vector<size_t> m_offsets;
+
+public:
+    /**
+     * @brief Default constructor: Initializes a vector without rows.
+     */
+    JaggedVector();
+
+    /**
+     * @brief Constructor that flattens a vector of vectors.
+     *
+     * @param nested The rows to copy.
+     */
+    explicit JaggedVector(const Vector<Vector<T>>& nested);
+
+    /**
+     * @brief Returns the number of rows.
+     */
+    size_t getRowCount() const;
+
+    /**
+     * @brief Returns the total number of values in all rows.
+     */
+    size_t getValueCount() const;
+
+    /**
+     * @brief Checks if there are no rows.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of values in a row.
+     *
+     * @param index The index of the row.
+     */
+    size_t rowSize(size_t index) const;
+
+    /**
+     * @brief Access to a row by index without bounds checking.
+     *
+     * The span stays valid until the next operation that adds values.
+     *
+     * @param index The index of the row.
+     * @return Span over the values of the row.
+     */
+    std::span<T> row(size_t index);
+
+    /**
+     * @brief Const version row().
+     */
+    std::span<const T> row(size_t index) const;
+
+    /**
+     * @brief Access to a row by index with bounds checking.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    std::span<T> rowAt(size_t index);
+
+    /**
+     * @brief Const version rowAt().
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    std::span<const T> rowAt(size_t index) const;
+
+    /**
+     * @brief Returns all values of all rows as one span.
+     */
+    std::span<T> values();
+
+    /**
+     * @brief Const version values().
+     */
+    std::span<const T> values() const;
+
+    /**
+     * @brief Appends a new row with the elements of a range.
+     *
+     * The range must not refer to the values of this vector.
+     *
+     * @param range Any range that can be used in a range-based for loop.
+     */
+    template<typename Range>
+    void push_row(const Range& range);
+
+    /**
+     * @brief Appends a new row with the elements of an initializer list.
+     *
+     * @param init_list The values of the new row.
+     */
+    void push_row(std::initializer_list<T> init_list);
+
+    /**
+     * @brief Appends a value to the last row.
+     *
+     * @param value The value to add.
+     * @throw std::out_of_range If there are no rows.
+     */
+    void push_back_to_last_row(const T& value);
+
+    /**
+     * @brief Appends a value to the last row using move semantics.
+     *
+     * @param value The value to add.
+     * @throw std::out_of_range If there are no rows.
+     */
+    void push_back_to_last_row(T&& value);
+
+    /**
+     * @brief Removes the last row with its values.
+     *
+     * @throw std::out_of_range If there are no rows.
+     */
+    void pop_row();
+
+    /**
+     * @brief Replaces the contents with rows of the given sizes.
+     *
+     * This is the first step of a two-pass build: count the values of every row,
+     * call this method, then fill each row through row(i). Rows do not overlap,
+     * so different rows may be filled from different threads.
+     *
+     * @param counts The number of values in each row.
+     * @param value The value to initialize all values with (default is T()).
+     */
+    void build_from_counts(const Vector<size_t>& counts, const T& value = T());
+
+    /**
+     * @brief Pre-allocation of memory for rows and values.
+     *
+     * @param row_capacity The number of rows to reserve space for.
+     * @param value_capacity The total number of values to reserve space for.
+     */
+    void reserve(size_t row_capacity, size_t value_capacity);
+
+    /**
+     * @brief Removes all rows but doesn't free the memory.
+     */
+    void clear();
+
+    /**
+     * @brief Converts back to a vector with one inner vector per row.
+     *
+     * @return The rows as separate vectors.
+     */
+    Vector<Vector<T>> to_nested() const;
+};
+
+template <typename T>
+JaggedVector<T>::JaggedVector()
+{
+    m_offsets.push_back(0);
+}
+
+template <typename T>
+JaggedVector<T>::JaggedVector(const Vector<Vector<T>>& nested)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < nested.getSize(); ++i)
+    {
+        total += nested[i].getSize();
+    }
+
+    reserve(nested.getSize(), total);
+    m_offsets.push_back(0);
+    for (size_t i = 0; i < nested.getSize(); ++i)
+    {
+        push_row(nested[i]);
+    }
+}
+
+template <typename T>
+size_t JaggedVector<T>::getRowCount() const
+{
+    return m_offsets.getSize() - 1;
+}
+
+template <typename T>
+size_t JaggedVector<T>::getValueCount() const
+{
+    return m_values.getSize();
+}
+
+template <typename T>
+bool JaggedVector<T>::empty() const
+{
+    return getRowCount() == 0;
+}
+
+template <typename T>
+size_t JaggedVector<T>::rowSize(size_t index) const
+{
+    return m_offsets[index + 1] - m_offsets[index];
+}
+
+template <typename T>
+std::span<T> JaggedVector<T>::row(size_t index)
+{
+    return std::span<T>(m_values.data() + m_offsets[index], rowSize(index));
+}
+
+template <typename T>
+std::span<const T> JaggedVector<T>::row(size_t index) const
+{
+    return std::span<const T>(m_values.data() + m_offsets[index], rowSize(index));
+}
+
+template <typename T>
+std::span<T> JaggedVector<T>::rowAt(size_t index)
+{
+    if (index >= getRowCount())
+    {
+        throw std::out_of_range("Row index out of range");
+    }
+    return row(index);
+}
+
+template <typename T>
+std::span<const T> JaggedVector<T>::rowAt(size_t index) const
+{
+    if (index >= getRowCount())
+    {
+        throw std::out_of_range("Row index out of range");
+    }
+    return row(index);
+}
+
+template <typename T>
+std::span<T> JaggedVector<T>::values()
+{
+    return std::span<T>(m_values.data(), m_values.getSize());
+}
+
+template <typename T>
+std::span<const T> JaggedVector<T>::values() const
+{
+    return std::span<const T>(m_values.data(), m_values.getSize());
+}
+
+template <typename T>
+template <typename Range>
+void JaggedVector<T>::push_row(const Range& range)
+{
+    for (auto &&element : range)
+    {
+        m_values.push_back(element);
+    }
+    m_offsets.push_back(m_values.getSize());
+}
+
+template <typename T>
+void JaggedVector<T>::push_row(std::initializer_list<T> init_list)
+{
+    m_values.reserve(m_values.getSize() + init_list.size());
+    for (auto &&element : init_list)
+    {
+        m_values.push_back(element);
+    }
+    m_offsets.push_back(m_values.getSize());
+}
+
+template <typename T>
+void JaggedVector<T>::push_back_to_last_row(const T& value)
+{
+    if (empty())
+    {
+        throw std::out_of_range("JaggedVector has no rows");
+    }
+    m_values.push_back(value);
+    ++m_offsets[getRowCount()];
+}
+
+template <typename T>
+void JaggedVector<T>::push_back_to_last_row(T&& value)
+{
+    if (empty())
+    {
+        throw std::out_of_range("JaggedVector has no rows");
+    }
+    m_values.push_back(std::move(value));
+    ++m_offsets[getRowCount()];
+}
+
+template <typename T>
+void JaggedVector<T>::pop_row()
+{
+    if (empty())
+    {
+        throw std::out_of_range("Can't pop_row from an empty JaggedVector");
+    }
+    m_offsets.pop_back();
+    m_values.resize(m_offsets[getRowCount()]);
+}
+
+template <typename T>
+void JaggedVector<T>::build_from_counts(const Vector<size_t>& counts, const T& value)
+{
+    clear();
+    m_offsets.reserve(counts.getSize() + 1);
+
+    size_t total = 0;
+    for (size_t i = 0; i < counts.getSize(); ++i)
+    {
+        total += counts[i];
+        m_offsets.push_back(total);
+    }
+    m_values.resize(total, value);
+}
+
+template <typename T>
+void JaggedVector<T>::reserve(size_t row_capacity, size_t value_capacity)
+{
+    m_offsets.reserve(row_capacity + 1);
+    m_values.reserve(value_capacity);
+}
+
+template <typename T>
+void JaggedVector<T>::clear()
+{
+    m_values.clear();
+    m_offsets.clear();
+    m_offsets.push_back(0);
+}
+
+template <typename T>
+Vector<Vector<T>> JaggedVector<T>::to_nested() const
+{
+    Vector<Vector<T>> nested(getRowCount());
+    for (size_t i = 0; i < getRowCount(); ++i)
+    {
+        Vector<T> inner(rowSize(i));
+        for (const T& element : row(i))
+        {
+            inner.push_back(element);
+        }
+        nested.push_back(std::move(inner));
+    }
+    return nested;
+}
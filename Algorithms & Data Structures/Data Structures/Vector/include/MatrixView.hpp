@@ -0,0 +1,562 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include "Vector.hpp"
+
+/**
+ * @file MatrixView.hpp
+ * @brief Multidimensional views over the storage of a Vector, and cache-blocked kernels.
+ *
+ * A view doesn't own or copy anything: it maps indices to positions in an existing
+ * buffer. The buffer must outlive the view and must not be reallocated while the
+ * view is in use.
+ */
+
+/**
+ * @brief How the elements of a matrix are arranged in memory.
+ */
+enum class Layout
+{
+    /**
+     * @brief Rows one after another: element (r, c) at r * cols + c.
+     */
+    RowMajor,
+
+    /**
+     * @brief Columns one after another: element (r, c) at c * rows + r.
+     */
+    ColumnMajor,
+
+    /**
+     * @brief Tiles of tile_rows x tile_cols elements, stored tile row by tile row,
+     *        each tile in row-major order. Rows and columns are padded to whole tiles.
+     */
+    Tiled
+};
+
+/**
+ * @brief Two-dimensional view with row-major, column-major or tiled layout.
+ *
+ * @tparam T The element type; const T gives a read-only view.
+ */
+template<typename T>
+class MatrixView
+{
+public:
+    using value_type = std::remove_const_t<T>;
+    using StorageRef = std::conditional_t<std::is_const_v<T>, const Vector<value_type>&, Vector<value_type>&>;
+
+private:
+    T* m_data;
+    size_t m_rows;
+    size_t m_cols;
+    Layout m_layout;
+    size_t m_tile_rows;
+    size_t m_tile_cols;
+
+    /**
+     * @brief Number of tiles in one tile row; only used by the tiled layout.
+     */
+    size_t m_tiles_per_row;
+
+public:
+    /**
+     * @brief Returns the number of elements a buffer needs to hold a matrix in the given layout.
+     *
+     * @param rows The number of rows.
+     * @param cols The number of columns.
+     * @param layout The memory layout.
+     * @param tile_rows Rows per tile; only used by Layout::Tiled.
+     * @param tile_cols Columns per tile; only used by Layout::Tiled.
+     */
+    static size_t required_size(size_t rows, size_t cols, Layout layout, size_t tile_rows = 32, size_t tile_cols = 32);
+
+    /**
+     * @brief Constructor over raw storage.
+     *
+     * @param data Pointer to the first element.
+     * @param size The number of elements available at data.
+     * @param rows The number of rows.
+     * @param cols The number of columns.
+     * @param layout The memory layout.
+     * @param tile_rows Rows per tile; only used by Layout::Tiled.
+     * @param tile_cols Columns per tile; only used by Layout::Tiled.
+     * @throw std::invalid_argument If a tile dimension is zero or the storage is too small.
+     */
+    MatrixView(T* data, size_t size, size_t rows, size_t cols, Layout layout = Layout::RowMajor,
+               size_t tile_rows = 32, size_t tile_cols = 32);
+
+    /**
+     * @brief Constructor over the elements of a vector.
+     *
+     * @throw std::invalid_argument If a tile dimension is zero or the vector is too small.
+     */
+    MatrixView(StorageRef storage, size_t rows, size_t cols, Layout layout = Layout::RowMajor,
+               size_t tile_rows = 32, size_t tile_cols = 32);
+
+    /**
+     * @brief Conversion of a writable view to a read-only one.
+     */
+    operator MatrixView<const T>() const;
+
+    size_t rows() const { return m_rows; }
+    size_t cols() const { return m_cols; }
+    Layout layout() const { return m_layout; }
+    size_t tile_rows() const { return m_tile_rows; }
+    size_t tile_cols() const { return m_tile_cols; }
+    T* data() const { return m_data; }
+
+    /**
+     * @brief Returns the position of element (row, col) in the buffer.
+     */
+    size_t offset(size_t row, size_t col) const;
+
+    /**
+     * @brief Access to an element without bounds checking.
+     */
+    T& operator()(size_t row, size_t col) const;
+
+    /**
+     * @brief Access to an element with bounds checking.
+     *
+     * @throw std::out_of_range If the row or column is out of range.
+     */
+    T& at(size_t row, size_t col) const;
+
+    /**
+     * @brief Returns the same buffer viewed as the transposed matrix, without moving anything.
+     *
+     * A row-major matrix read column by column is a column-major matrix, and vice versa.
+     *
+     * @throw std::invalid_argument For tiled views.
+     */
+    MatrixView transposed() const;
+};
+
+/**
+ * @brief View with any number of dimensions in row-major or column-major layout.
+ *
+ * @tparam T The element type; const T gives a read-only view.
+ * @tparam Rank The number of dimensions.
+ */
+template<typename T, size_t Rank>
+class TensorView
+{
+    static_assert(Rank > 0, "TensorView needs at least one dimension");
+
+public:
+    using value_type = std::remove_const_t<T>;
+    using StorageRef = std::conditional_t<std::is_const_v<T>, const Vector<value_type>&, Vector<value_type>&>;
+
+private:
+    T* m_data;
+    std::array<size_t, Rank> m_extents;
+    std::array<size_t, Rank> m_strides;
+
+public:
+    /**
+     * @brief Constructor over the elements of a vector.
+     *
+     * @param storage The vector holding the elements.
+     * @param extents The size of every dimension.
+     * @param layout Layout::RowMajor (last index contiguous) or Layout::ColumnMajor (first index contiguous).
+     * @throw std::invalid_argument If the layout is tiled or the vector is too small.
+     */
+    TensorView(StorageRef storage, const std::array<size_t, Rank>& extents, Layout layout = Layout::RowMajor);
+
+    size_t extent(size_t dimension) const { return m_extents[dimension]; }
+    size_t stride(size_t dimension) const { return m_strides[dimension]; }
+    T* data() const { return m_data; }
+
+    /**
+     * @brief Returns the number of elements in the view.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Access to an element without bounds checking.
+     *
+     * @param indices One index per dimension.
+     */
+    template<typename... Indices>
+    T& operator()(Indices... indices) const
+    {
+        static_assert(sizeof...(Indices) == Rank, "TensorView needs one index per dimension");
+        std::array<size_t, Rank> index{static_cast<size_t>(indices)...};
+        size_t position = 0;
+        for (size_t d = 0; d < Rank; ++d)
+        {
+            position += index[d] * m_strides[d];
+        }
+        return m_data[position];
+    }
+};
+
+template <typename T>
+size_t MatrixView<T>::required_size(size_t rows, size_t cols, Layout layout, size_t tile_rows, size_t tile_cols)
+{
+    if (layout != Layout::Tiled)
+    {
+        return rows * cols;
+    }
+    size_t padded_rows = (rows + tile_rows - 1) / tile_rows * tile_rows;
+    size_t padded_cols = (cols + tile_cols - 1) / tile_cols * tile_cols;
+    return padded_rows * padded_cols;
+}
+
+template <typename T>
+MatrixView<T>::MatrixView(T* data, size_t size, size_t rows, size_t cols, Layout layout,
+                          size_t tile_rows, size_t tile_cols)
+    : m_data(data), m_rows(rows), m_cols(cols), m_layout(layout), m_tile_rows(tile_rows), m_tile_cols(tile_cols),
+      m_tiles_per_row(0)
+{
+    if (tile_rows == 0 || tile_cols == 0)
+    {
+        throw std::invalid_argument("Tile dimensions must be positive");
+    }
+    if (size < required_size(rows, cols, layout, tile_rows, tile_cols))
+    {
+        throw std::invalid_argument("Storage is too small for the matrix");
+    }
+    m_tiles_per_row = (cols + tile_cols - 1) / tile_cols;
+}
+
+template <typename T>
+MatrixView<T>::MatrixView(StorageRef storage, size_t rows, size_t cols, Layout layout,
+                          size_t tile_rows, size_t tile_cols)
+    : MatrixView(storage.data(), storage.getSize(), rows, cols, layout, tile_rows, tile_cols)
+{
+}
+
+template <typename T>
+MatrixView<T>::operator MatrixView<const T>() const
+{
+    return MatrixView<const T>(m_data, required_size(m_rows, m_cols, m_layout, m_tile_rows, m_tile_cols),
+                               m_rows, m_cols, m_layout, m_tile_rows, m_tile_cols);
+}
+
+template <typename T>
+size_t MatrixView<T>::offset(size_t row, size_t col) const
+{
+    switch (m_layout)
+    {
+    case Layout::RowMajor:
+        return row * m_cols + col;
+    case Layout::ColumnMajor:
+        return col * m_rows + row;
+    default:
+    {
+        size_t tile = (row / m_tile_rows) * m_tiles_per_row + col / m_tile_cols;
+        return tile * m_tile_rows * m_tile_cols + (row % m_tile_rows) * m_tile_cols + col % m_tile_cols;
+    }
+    }
+}
+
+template <typename T>
+T& MatrixView<T>::operator()(size_t row, size_t col) const
+{
+    return m_data[offset(row, col)];
+}
+
+template <typename T>
+T& MatrixView<T>::at(size_t row, size_t col) const
+{
+    if (row >= m_rows || col >= m_cols)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+    return m_data[offset(row, col)];
+}
+
+template <typename T>
+MatrixView<T> MatrixView<T>::transposed() const
+{
+    if (m_layout == Layout::Tiled)
+    {
+        throw std::invalid_argument("Tiled views can't be transposed without copying");
+    }
+    Layout flipped = m_layout == Layout::RowMajor ? Layout::ColumnMajor : Layout::RowMajor;
+    return MatrixView(m_data, m_rows * m_cols, m_cols, m_rows, flipped);
+}
+
+template <typename T, size_t Rank>
+TensorView<T, Rank>::TensorView(StorageRef storage, const std::array<size_t, Rank>& extents, Layout layout)
+    : m_data(storage.data()), m_extents(extents)
+{
+    if (layout == Layout::Tiled)
+    {
+        throw std::invalid_argument("TensorView supports only row-major and column-major layouts");
+    }
+
+    size_t stride = 1;
+    for (size_t i = 0; i < Rank; ++i)
+    {
+        size_t d = layout == Layout::RowMajor ? Rank - 1 - i : i;
+        m_strides[d] = stride;
+        stride *= m_extents[d];
+    }
+    if (storage.getSize() < stride)
+    {
+        throw std::invalid_argument("Storage is too small for the tensor");
+    }
+}
+
+template <typename T, size_t Rank>
+size_t TensorView<T, Rank>::getSize() const
+{
+    size_t size = 1;
+    for (size_t d = 0; d < Rank; ++d)
+    {
+        size *= m_extents[d];
+    }
+    return size;
+}
+
+namespace matrix_detail
+{
+    /**
+     * @brief Edge of the square blocks used by the kernels. 32 x 32 doubles are 8 KiB,
+     *        so a source and a destination block fit in L1 together.
+     */
+    constexpr size_t kBlock = 32;
+
+    template<typename A, typename B>
+    void require_same_shape(const MatrixView<A>& a, const MatrixView<B>& b)
+    {
+        if (a.rows() != b.rows() || a.cols() != b.cols())
+        {
+            throw std::invalid_argument("Matrix dimensions don't match");
+        }
+    }
+}
+
+/**
+ * @brief Writes the transpose of source into destination, block by block.
+ *
+ * Walking a whole column of a large matrix touches a new cache line on every step;
+ * walking square blocks keeps both the rows read and the columns written in cache.
+ *
+ * @param source The matrix to transpose, rows x cols.
+ * @param destination The result, cols x rows, in any layout. Must not overlap source.
+ * @throw std::invalid_argument If the dimensions don't match.
+ */
+template<typename S, typename T>
+void transpose(const MatrixView<S>& source, const MatrixView<T>& destination)
+{
+    if (destination.rows() != source.cols() || destination.cols() != source.rows())
+    {
+        throw std::invalid_argument("Matrix dimensions don't match");
+    }
+
+    using matrix_detail::kBlock;
+    for (size_t r0 = 0; r0 < source.rows(); r0 += kBlock)
+    {
+        size_t r1 = std::min(r0 + kBlock, source.rows());
+        for (size_t c0 = 0; c0 < source.cols(); c0 += kBlock)
+        {
+            size_t c1 = std::min(c0 + kBlock, source.cols());
+            for (size_t r = r0; r < r1; ++r)
+            {
+                for (size_t c = c0; c < c1; ++c)
+                {
+                    destination(c, r) = source(r, c);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Transposes a square matrix in its own buffer by swapping mirrored blocks.
+ *
+ * @param matrix The matrix to transpose.
+ * @throw std::invalid_argument If the matrix is not square.
+ */
+template<typename T>
+void transpose_in_place(const MatrixView<T>& matrix)
+{
+    if (matrix.rows() != matrix.cols())
+    {
+        throw std::invalid_argument("In-place transpose needs a square matrix");
+    }
+
+    using matrix_detail::kBlock;
+    size_t n = matrix.rows();
+    for (size_t r0 = 0; r0 < n; r0 += kBlock)
+    {
+        size_t r1 = std::min(r0 + kBlock, n);
+        for (size_t c0 = r0; c0 < n; c0 += kBlock)
+        {
+            size_t c1 = std::min(c0 + kBlock, n);
+            for (size_t r = r0; r < r1; ++r)
+            {
+                // On the diagonal block only the upper triangle is swapped.
+                for (size_t c = std::max(c0, r + 1); c < c1; ++c)
+                {
+                    std::swap(matrix(r, c), matrix(c, r));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Copies a matrix into another layout, block by block.
+ *
+ * @param source The matrix to copy.
+ * @param destination A matrix of the same dimensions. Must not overlap source.
+ * @throw std::invalid_argument If the dimensions don't match.
+ */
+template<typename S, typename T>
+void convert_layout(const MatrixView<S>& source, const MatrixView<T>& destination)
+{
+    matrix_detail::require_same_shape(source, destination);
+
+    using matrix_detail::kBlock;
+    for (size_t r0 = 0; r0 < source.rows(); r0 += kBlock)
+    {
+        size_t r1 = std::min(r0 + kBlock, source.rows());
+        for (size_t c0 = 0; c0 < source.cols(); c0 += kBlock)
+        {
+            size_t c1 = std::min(c0 + kBlock, source.cols());
+            for (size_t r = r0; r < r1; ++r)
+            {
+                for (size_t c = c0; c < c1; ++c)
+                {
+                    destination(r, c) = source(r, c);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Matrix product result = a * b with loop tiling.
+ *
+ * The product is computed block by block so that a block of a, a block of b and a
+ * block of the result stay in cache while they are used. When b and the result are
+ * row-major, the innermost loop runs over contiguous memory and can be vectorized.
+ *
+ * @param a Left operand, n x k.
+ * @param b Right operand, k x m.
+ * @param result Receives the n x m product; overwritten. Must not overlap a or b.
+ * @throw std::invalid_argument If the dimensions don't match.
+ */
+template<typename A, typename B, typename T>
+void matmul(const MatrixView<A>& a, const MatrixView<B>& b, const MatrixView<T>& result)
+{
+    if (a.cols() != b.rows() || result.rows() != a.rows() || result.cols() != b.cols())
+    {
+        throw std::invalid_argument("Matrix dimensions don't match");
+    }
+
+    for (size_t i = 0; i < result.rows(); ++i)
+    {
+        for (size_t j = 0; j < result.cols(); ++j)
+        {
+            result(i, j) = T();
+        }
+    }
+
+    using matrix_detail::kBlock;
+    bool contiguous_rows = b.layout() == Layout::RowMajor && result.layout() == Layout::RowMajor;
+    for (size_t i0 = 0; i0 < a.rows(); i0 += kBlock)
+    {
+        size_t i1 = std::min(i0 + kBlock, a.rows());
+        for (size_t k0 = 0; k0 < a.cols(); k0 += kBlock)
+        {
+            size_t k1 = std::min(k0 + kBlock, a.cols());
+            for (size_t j0 = 0; j0 < b.cols(); j0 += kBlock)
+            {
+                size_t j1 = std::min(j0 + kBlock, b.cols());
+                for (size_t i = i0; i < i1; ++i)
+                {
+                    for (size_t k = k0; k < k1; ++k)
+                    {
+                        std::remove_const_t<A> scale = a(i, k);
+                        if (contiguous_rows)
+                        {
+                            const B* b_row = &b(k, 0);
+                            T* result_row = &result(i, 0);
+                            for (size_t j = j0; j < j1; ++j)
+                            {
+                                result_row[j] += scale * b_row[j];
+                            }
+                        }
+                        else
+                        {
+                            for (size_t j = j0; j < j1; ++j)
+                            {
+                                result(i, j) += scale * b(k, j);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sums every row of a matrix.
+ *
+ * Elements are visited in blocks so that column-major and tiled matrices are read
+ * with good locality too.
+ *
+ * @param matrix The matrix to reduce.
+ * @param sums Receives matrix.rows() sums.
+ */
+template<typename T>
+void row_sums(const MatrixView<T>& matrix, Vector<std::remove_const_t<T>>& sums)
+{
+    sums.assign(matrix.rows(), std::remove_const_t<T>());
+
+    using matrix_detail::kBlock;
+    for (size_t r0 = 0; r0 < matrix.rows(); r0 += kBlock)
+    {
+        size_t r1 = std::min(r0 + kBlock, matrix.rows());
+        for (size_t c0 = 0; c0 < matrix.cols(); c0 += kBlock)
+        {
+            size_t c1 = std::min(c0 + kBlock, matrix.cols());
+            for (size_t r = r0; r < r1; ++r)
+            {
+                for (size_t c = c0; c < c1; ++c)
+                {
+                    sums[r] += matrix(r, c);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sums every column of a matrix.
+ *
+ * @param matrix The matrix to reduce.
+ * @param sums Receives matrix.cols() sums.
+ */
+template<typename T>
+void column_sums(const MatrixView<T>& matrix, Vector<std::remove_const_t<T>>& sums)
+{
+    sums.assign(matrix.cols(), std::remove_const_t<T>());
+
+    using matrix_detail::kBlock;
+    for (size_t r0 = 0; r0 < matrix.rows(); r0 += kBlock)
+    {
+        size_t r1 = std::min(r0 + kBlock, matrix.rows());
+        for (size_t c0 = 0; c0 < matrix.cols(); c0 += kBlock)
+        {
+            size_t c1 = std::min(c0 + kBlock, matrix.cols());
+            for (size_t r = r0; r < r1; ++r)
+            {
+                for (size_t c = c0; c < c1; ++c)
+                {
+                    sums[c] += matrix(r, c);
+                }
+            }
+        }
+    }
+}
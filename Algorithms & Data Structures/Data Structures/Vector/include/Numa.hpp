@@ -0,0 +1,443 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "Parallel.hpp"
+#include "Vector.hpp"
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define NUMA_USE_LINUX 1
+#endif
+
+/**
+ * @file Numa.hpp
+ * @brief NUMA-aware parallel construction, filling and copying of large vectors.
+ *
+ * Linux places a page on the NUMA node of the thread that first writes it. When one
+ * thread fills a multi-gigabyte vector, every page ends up on that thread's node and
+ * later parallel scans from the other sockets run at remote-memory bandwidth.
+ *
+ * The functions here allocate a fresh buffer and do the first write from several
+ * threads, each pinned to the CPUs of one node, so the pages are spread either in
+ * contiguous parts (matching how parallel_for later splits the range) or page by
+ * page round-robin across nodes. numa_locality() reports where the pages of a
+ * vector actually are.
+ *
+ * Placement only works for types whose default construction doesn't write memory
+ * (trivial types); for others the buffer is already touched when it is allocated,
+ * and the functions are merely parallel. Outside Linux nothing is pinned.
+ */
+
+/**
+ * @brief How pages are spread across NUMA nodes.
+ */
+enum class NumaPlacement
+{
+    /**
+     * @brief The range is split into one contiguous part per thread; consecutive parts share a node.
+     */
+    Partitioned,
+
+    /**
+     * @brief Pages are assigned to the threads, and through them to the nodes, round-robin.
+     */
+    Interleaved
+};
+
+/**
+ * @brief Parameters for the numa_* functions.
+ */
+struct NumaOptions
+{
+    NumaPlacement placement = NumaPlacement::Partitioned;
+
+    /**
+     * @brief Number of threads; 0 means default_thread_count().
+     */
+    size_t thread_count = 0;
+
+    /**
+     * @brief Whether each thread is pinned to the CPUs of its node while it writes.
+     */
+    bool pin_threads = true;
+};
+
+/**
+ * @brief Where the pages of a vector are.
+ */
+struct NumaLocality
+{
+    /**
+     * @brief False if the kernel couldn't be asked, for example outside Linux.
+     */
+    bool available = false;
+
+    /**
+     * @brief The number of pages spanned by the elements.
+     */
+    size_t total_pages = 0;
+
+    /**
+     * @brief Pages per node, indexed by node id.
+     */
+    Vector<size_t> pages_per_node;
+
+    /**
+     * @brief Pages that have never been written and so belong to no node yet.
+     */
+    size_t unplaced_pages = 0;
+};
+
+namespace numa_detail
+{
+    /**
+     * @brief Below this number of bytes the work is done on the calling thread.
+     */
+    constexpr size_t kParallelThreshold = 1 << 20;
+
+    /**
+     * @brief Pages queried per move_pages call.
+     */
+    constexpr size_t kQueryBatch = 1024;
+
+    /**
+     * @brief Parses a sysfs list such as "0-3,8,10-11".
+     */
+    inline Vector<int> parse_cpu_list(const std::string& text)
+    {
+        Vector<int> result;
+        size_t position = 0;
+        while (position < text.size())
+        {
+            size_t comma = text.find(',', position);
+            if (comma == std::string::npos)
+            {
+                comma = text.size();
+            }
+            std::string item = text.substr(position, comma - position);
+            position = comma + 1;
+            if (item.empty() || item[0] < '0' || item[0] > '9')
+            {
+                continue;
+            }
+
+            size_t dash = item.find('-');
+            int first = std::stoi(item.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+            for (int value = first; value <= last; ++value)
+            {
+                result.push_back(value);
+            }
+        }
+        return result;
+    }
+
+    inline Vector<int> read_list(const std::string& path)
+    {
+        std::ifstream file(path);
+        std::string line;
+        if (!file || !std::getline(file, line))
+        {
+            return Vector<int>();
+        }
+        return parse_cpu_list(line);
+    }
+
+    /**
+     * @brief Node ids and the CPUs of each node, read once from sysfs.
+     *
+     * Without sysfs there is a single node with an empty CPU list, so nothing is pinned.
+     */
+    struct Topology
+    {
+        Vector<int> nodes;
+        Vector<Vector<int>> cpus;
+
+        Topology()
+        {
+#if defined(NUMA_USE_LINUX)
+            Vector<int> online = read_list("/sys/devices/system/node/online");
+            for (int node : online)
+            {
+                Vector<int> node_cpus = read_list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                if (!node_cpus.empty())
+                {
+                    nodes.push_back(node);
+                    cpus.push_back(std::move(node_cpus));
+                }
+            }
+#endif
+            if (nodes.empty())
+            {
+                nodes.push_back(0);
+                cpus.push_back(Vector<int>());
+            }
+        }
+    };
+
+    inline const Topology& topology()
+    {
+        static const Topology instance;
+        return instance;
+    }
+
+    inline size_t page_size()
+    {
+#if defined(NUMA_USE_LINUX)
+        long size = sysconf(_SC_PAGESIZE);
+        return size > 0 ? static_cast<size_t>(size) : 4096;
+#else
+        return 4096;
+#endif
+    }
+
+    /**
+     * @brief Pins the calling thread to a set of CPUs and restores its previous affinity on destruction.
+     *
+     * The first part of parallel_for runs on the caller's thread, so its affinity must be put back.
+     */
+    class AffinityGuard
+    {
+    private:
+#if defined(NUMA_USE_LINUX)
+        cpu_set_t m_previous;
+#endif
+        bool m_pinned = false;
+
+    public:
+        AffinityGuard(const Vector<int>& cpus, bool pin)
+        {
+#if defined(NUMA_USE_LINUX)
+            if (!pin || cpus.empty() || sched_getaffinity(0, sizeof(m_previous), &m_previous) != 0)
+            {
+                return;
+            }
+            cpu_set_t mask;
+            CPU_ZERO(&mask);
+            for (int cpu : cpus)
+            {
+                if (cpu < CPU_SETSIZE)
+                {
+                    CPU_SET(cpu, &mask);
+                }
+            }
+            // Failure (for example CPUs outside our cpuset) just leaves the thread unpinned.
+            m_pinned = sched_setaffinity(0, sizeof(mask), &mask) == 0;
+#else
+            (void)cpus;
+            (void)pin;
+#endif
+        }
+
+        ~AffinityGuard()
+        {
+#if defined(NUMA_USE_LINUX)
+            if (m_pinned)
+            {
+                sched_setaffinity(0, sizeof(m_previous), &m_previous);
+            }
+#endif
+        }
+
+        AffinityGuard(const AffinityGuard&) = delete;
+        AffinityGuard& operator=(const AffinityGuard&) = delete;
+    };
+
+    /**
+     * @brief Calls body(begin, end) over [0, count) from threads pinned to nodes, following the placement.
+     *
+     * @param count The number of elements.
+     * @param element_size sizeof the element type, used to find page boundaries.
+     * @param options Placement, thread count and pinning.
+     * @param body Callable taking (size_t begin, size_t end); called concurrently on disjoint ranges.
+     */
+    template<typename Body>
+    void for_each_placed(size_t count, size_t element_size, const NumaOptions& options, Body&& body)
+    {
+        size_t threads = options.thread_count == 0 ? default_thread_count() : options.thread_count;
+        if (count * element_size < kParallelThreshold || threads <= 1)
+        {
+            body(0, count);
+            return;
+        }
+
+        const Topology& nodes = topology();
+        size_t node_count = nodes.nodes.getSize();
+
+        if (options.placement == NumaPlacement::Partitioned)
+        {
+            parallel_for(0, count, threads, [&](size_t begin, size_t end, size_t worker) {
+                AffinityGuard guard(nodes.cpus[worker * node_count / threads], options.pin_threads);
+                body(begin, end);
+            });
+            return;
+        }
+
+        size_t per_page = std::max<size_t>(1, page_size() / element_size);
+        size_t pages = (count + per_page - 1) / per_page;
+        threads = std::min(threads, pages);
+        parallel_for(0, threads, threads, [&](size_t, size_t, size_t worker) {
+            AffinityGuard guard(nodes.cpus[worker % node_count], options.pin_threads);
+            for (size_t page = worker; page < pages; page += threads)
+            {
+                body(page * per_page, std::min(count, (page + 1) * per_page));
+            }
+        });
+    }
+}
+
+/**
+ * @brief Returns the number of NUMA nodes with CPUs; 1 if the topology can't be read.
+ */
+inline size_t numa_node_count()
+{
+    return numa_detail::topology().nodes.getSize();
+}
+
+/**
+ * @brief Parallel, NUMA-placed replacement for resize(count, value) on a fresh or cleared vector.
+ *
+ * If count exceeds the capacity, a new buffer is allocated and first written by
+ * threads pinned to nodes; otherwise the existing pages are reused (and stay
+ * where they are) and only the writing is parallel. All count elements are set
+ * to value, including ones that were there before.
+ *
+ * @param vector The vector to fill.
+ * @param count The new size.
+ * @param value The value of every element.
+ * @param options Placement, thread count and pinning.
+ */
+template<typename T>
+void numa_fill(Vector<T>& vector, size_t count, const T& value, const NumaOptions& options = NumaOptions())
+{
+    if (count > vector.getCapacity())
+    {
+        Vector<T> fresh(count);
+        fresh.swap(vector);
+    }
+    vector.resize_for_overwrite(count);
+
+    T* data = vector.data();
+    numa_detail::for_each_placed(count, sizeof(T), options, [&](size_t begin, size_t end) {
+        std::fill(data + begin, data + end, value);
+    });
+}
+
+/**
+ * @brief Parallel, NUMA-placed replacement for reserve().
+ *
+ * The new buffer is written in full: existing elements are moved in and the
+ * spare capacity is set to T(), so every page is placed now rather than by
+ * whichever thread later happens to append.
+ *
+ * @param vector The vector to grow.
+ * @param capacity The new capacity; nothing happens if it isn't larger than the current one.
+ * @param options Placement, thread count and pinning.
+ */
+template<typename T>
+void numa_reserve(Vector<T>& vector, size_t capacity, const NumaOptions& options = NumaOptions())
+{
+    if (capacity <= vector.getCapacity())
+    {
+        return;
+    }
+
+    Vector<T> fresh(capacity);
+    fresh.resize_for_overwrite(capacity);
+    T* target = fresh.data();
+    T* source = vector.data();
+    size_t size = vector.getSize();
+    numa_detail::for_each_placed(capacity, sizeof(T), options, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            target[i] = i < size ? std::move(source[i]) : T();
+        }
+    });
+    fresh.resize_for_overwrite(size);
+    vector.swap(fresh);
+}
+
+/**
+ * @brief Parallel, NUMA-placed replacement for the copy constructor.
+ *
+ * @param source The vector to copy.
+ * @param options Placement, thread count and pinning.
+ * @return A copy whose capacity equals its size.
+ */
+template<typename T>
+Vector<T> numa_copy(const Vector<T>& source, const NumaOptions& options = NumaOptions())
+{
+    size_t size = source.getSize();
+    Vector<T> copy(size);
+    copy.resize_for_overwrite(size);
+    T* target = copy.data();
+    const T* from = source.data();
+    numa_detail::for_each_placed(size, sizeof(T), options, [&](size_t begin, size_t end) {
+        std::copy(from + begin, from + end, target + begin);
+    });
+    return copy;
+}
+
+/**
+ * @brief Asks the kernel which node each page of a vector's elements is on.
+ *
+ * Uses move_pages(2) in query mode, which moves nothing. The result has
+ * available == false outside Linux or when the call is not permitted.
+ *
+ * @param vector The vector to inspect; only the first getSize() elements are considered.
+ */
+template<typename T>
+NumaLocality numa_locality(const Vector<T>& vector)
+{
+    NumaLocality report;
+    if (vector.getSize() == 0)
+    {
+        report.available = true;
+        return report;
+    }
+
+    size_t page = numa_detail::page_size();
+    uintptr_t first = reinterpret_cast<uintptr_t>(vector.data()) / page * page;
+    uintptr_t last = reinterpret_cast<uintptr_t>(vector.data() + vector.getSize());
+    report.total_pages = (last - first + page - 1) / page;
+
+#if defined(NUMA_USE_LINUX) && defined(SYS_move_pages)
+    void* pages[numa_detail::kQueryBatch];
+    int status[numa_detail::kQueryBatch];
+    for (size_t done = 0; done < report.total_pages; done += numa_detail::kQueryBatch)
+    {
+        size_t batch = std::min(numa_detail::kQueryBatch, report.total_pages - done);
+        for (size_t i = 0; i < batch; ++i)
+        {
+            pages[i] = reinterpret_cast<void*>(first + (done + i) * page);
+        }
+        if (syscall(SYS_move_pages, 0, static_cast<unsigned long>(batch), pages, nullptr, status, 0) != 0)
+        {
+            report.available = false;
+            report.pages_per_node.clear();
+            report.unplaced_pages = 0;
+            return report;
+        }
+        for (size_t i = 0; i < batch; ++i)
+        {
+            if (status[i] < 0)
+            {
+                ++report.unplaced_pages;
+                continue;
+            }
+            size_t node = static_cast<size_t>(status[i]);
+            if (node >= report.pages_per_node.getSize())
+            {
+                report.pages_per_node.resize(node + 1, 0);
+            }
+            ++report.pages_per_node[node];
+        }
+    }
+    report.available = true;
+#endif
+    return report;
+}
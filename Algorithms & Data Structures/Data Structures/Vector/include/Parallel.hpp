@@ -0,0 +1,90 @@
+#pragma once
+#include <exception>
+#include <mutex>
+#include <thread>
+#include "Vector.hpp"
+
+/**
+ * @brief Returns the number of threads to use when the caller doesn't specify one.
+ */
+inline size_t default_thread_count()
+{
+    unsigned count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : count;
+}
+
+/**
+ * @brief Splits [begin, end) into equal parts and processes them on separate threads.
+ *
+ * The first part runs on the calling thread. The call returns when all parts are
+ * done; if any part throws, the first exception is rethrown after all threads
+ * have finished.
+ *
+ * @param begin The first index of the range.
+ * @param end The index past the last one.
+ * @param thread_count The number of parts; 0 means default_thread_count().
+ * @param body Callable taking (size_t part_begin, size_t part_end, size_t worker).
+ */
+template<typename Body>
+void parallel_for(size_t begin, size_t end, size_t thread_count, Body&& body)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+    if (thread_count == 0)
+    {
+        thread_count = default_thread_count();
+    }
+    size_t length = end - begin;
+    if (thread_count > length)
+    {
+        thread_count = length;
+    }
+
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto run = [&](size_t worker) {
+        size_t part_begin = begin + length * worker / thread_count;
+        size_t part_end = begin + length * (worker + 1) / thread_count;
+        try
+        {
+            body(part_begin, part_end, worker);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    Vector<std::thread> threads(thread_count - 1);
+    try
+    {
+        for (size_t worker = 1; worker < thread_count; ++worker)
+        {
+            threads.push_back(std::thread(run, worker));
+        }
+    }
+    catch (...)
+    {
+        // Parts without a thread run here instead.
+        for (size_t worker = threads.getSize() + 1; worker < thread_count; ++worker)
+        {
+            run(worker);
+        }
+    }
+    run(0);
+    for (auto &&thread : threads)
+    {
+        thread.join();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
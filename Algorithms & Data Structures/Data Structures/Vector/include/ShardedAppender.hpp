@@ -0,0 +1,258 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Parallel.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Collects values from several threads into separate shards and merges them into one Vector.
+ *
+ * Every worker appends to its own shard, so push_back needs no locking. The shards
+ * are padded to a cache line each, so workers appending at the same time don't
+ * invalidate each other's size and capacity fields.
+ *
+ * finalize() computes where each shard starts in the result from the prefix sums
+ * of the shard sizes, grows the destination once, and moves the values in parallel.
+ * The result holds the values of shard 0 first, then shard 1 and so on, each shard
+ * in its own append order.
+ *
+ * Different shards may be used from different threads at the same time; a single
+ * shard, getSize(), finalize() and clear() must not run concurrently with appends.
+ *
+ * @tparam T The type of collected values.
+ */
+template<typename T>
+class ShardedAppender
+{
+private:
+    static constexpr size_t kCacheLine = 64;
+
+    /**
+     * @brief Below this number of values finalize() doesn't start threads.
+     */
+    static constexpr size_t kParallelThreshold = 16384;
+
+    struct alignas(kCacheLine) Shard
+    {
+        Vector<T> values;
+    };
+
+    /**
+     * @brief One shard per worker.
+     */
+    Vector<Shard> m_shards;
+
+    /**
+     * @brief Moves count values from source to target.
+     */
+    static void move_run(T* target, T* source, size_t count);
+
+public:
+    /**
+     * @brief Constructor with the number of shards.
+     *
+     * @param shard_count The number of shards; 0 means default_thread_count().
+     */
+    explicit ShardedAppender(size_t shard_count = 0);
+
+    /**
+     * @brief Returns the number of shards.
+     */
+    size_t getShardCount() const;
+
+    /**
+     * @brief Returns the total number of values in all shards.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Access to a shard by ID.
+     *
+     * @param id The ID of the shard, usually the index of the worker thread.
+     * @throw std::out_of_range If the ID is out of range.
+     */
+    Vector<T>& shard(size_t id);
+
+    /**
+     * @brief Appends a value to a shard.
+     *
+     * @param id The ID of the shard.
+     * @param value The value to add.
+     */
+    void push_back(size_t id, const T& value);
+
+    /**
+     * @brief Appends a value to a shard using move semantics.
+     *
+     * @param id The ID of the shard.
+     * @param value The value to add.
+     */
+    void push_back(size_t id, T&& value);
+
+    /**
+     * @brief Pre-allocation of memory in every shard.
+     *
+     * @param per_shard_capacity The number of values to reserve space for in each shard.
+     */
+    void reserve(size_t per_shard_capacity);
+
+    /**
+     * @brief Moves all values to the end of a destination vector, in shard order.
+     *
+     * The destination grows once. The shards are left empty but keep their memory.
+     *
+     * @param destination The vector to append to.
+     * @param thread_count The number of threads; 0 means default_thread_count().
+     */
+    void finalize(Vector<T>& destination, size_t thread_count = 0);
+
+    /**
+     * @brief Moves all values into a new vector, in shard order.
+     *
+     * @param thread_count The number of threads; 0 means default_thread_count().
+     * @return The merged values.
+     */
+    Vector<T> finalize(size_t thread_count = 0);
+
+    /**
+     * @brief Removes the values of all shards but doesn't free the memory.
+     */
+    void clear();
+};
+
+template <typename T>
+ShardedAppender<T>::ShardedAppender(size_t shard_count)
+{
+    // Initialize one empty shard per worker.
+    m_shards.resize(shard_count == 0 ? default_thread_count() : shard_count);
+}
+
+template <typename T>
+size_t ShardedAppender<T>::getShardCount() const
+{
+    return m_shards.getSize();
+}
+
+template <typename T>
+size_t ShardedAppender<T>::getSize() const
+{
+    size_t total = 0;
+    for (size_t i = 0; i < m_shards.getSize(); ++i)
+    {
+        total += m_shards[i].values.getSize();
+    }
+    return total;
+}
+
+template <typename T>
+Vector<T>& ShardedAppender<T>::shard(size_t id)
+{
+    if (id >= m_shards.getSize())
+    {
+        throw std::out_of_range("Shard ID out of range");
+    }
+    return m_shards[id].values;
+}
+
+template <typename T>
+void ShardedAppender<T>::push_back(size_t id, const T& value)
+{
+    shard(id).push_back(value);
+}
+
+template <typename T>
+void ShardedAppender<T>::push_back(size_t id, T&& value)
+{
+    shard(id).push_back(std::move(value));
+}
+
+template <typename T>
+void ShardedAppender<T>::reserve(size_t per_shard_capacity)
+{
+    for (size_t i = 0; i < m_shards.getSize(); ++i)
+    {
+        m_shards[i].values.reserve(per_shard_capacity);
+    }
+}
+
+template <typename T>
+void ShardedAppender<T>::move_run(T* target, T* source, size_t count)
+{
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        if (count != 0)
+        {
+            std::memcpy(static_cast<void*>(target), source, count * sizeof(T));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            target[i] = std::move(source[i]);
+        }
+    }
+}
+
+template <typename T>
+void ShardedAppender<T>::finalize(Vector<T>& destination, size_t thread_count)
+{
+    // starts[i] is where shard i begins among the merged values.
+    size_t shard_count = m_shards.getSize();
+    Vector<size_t> starts(shard_count + 1);
+    starts.push_back(0);
+    for (size_t i = 0; i < shard_count; ++i)
+    {
+        starts.push_back(starts[i] + m_shards[i].values.getSize());
+    }
+    size_t total = starts[shard_count];
+    if (total == 0)
+    {
+        return;
+    }
+
+    // The new slots are live objects from new T[], and every one of them is
+    // overwritten below, so filling them with T() first would only double the work.
+    size_t base = destination.getSize();
+    destination.resize_for_overwrite(base + total);
+    T* target = destination.data() + base;
+
+    // Split the merged range rather than the shards, so uneven shards still balance.
+    if (total < kParallelThreshold)
+    {
+        thread_count = 1;
+    }
+    parallel_for(0, total, thread_count, [&](size_t lo, size_t hi, size_t) {
+        size_t id = static_cast<size_t>(std::upper_bound(starts.data(), starts.data() + shard_count + 1, lo)
+                                        - starts.data()) - 1;
+        while (lo < hi)
+        {
+            size_t run_end = std::min(hi, starts[id + 1]);
+            move_run(target + lo, m_shards[id].values.data() + (lo - starts[id]), run_end - lo);
+            lo = run_end;
+            ++id;
+        }
+    });
+
+    clear();
+}
+
+template <typename T>
+Vector<T> ShardedAppender<T>::finalize(size_t thread_count)
+{
+    Vector<T> destination;
+    finalize(destination, thread_count);
+    return destination;
+}
+
+template <typename T>
+void ShardedAppender<T>::clear()
+{
+    for (size_t i = 0; i < m_shards.getSize(); ++i)
+    {
+        m_shards[i].values.clear();
+    }
+}
@@ -0,0 +1,540 @@
+#pragma once
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include "Vector.hpp"
+
+/**
+ * @brief Rule that decides when a ShrinkingVector gives memory back.
+ *
+ * The vector shrinks once its size has stayed below capacity / shrink_divisor
+ * for patience operations in a row. Waiting for several operations avoids
+ * shrinking and growing again when the size briefly dips.
+ */
+struct ShrinkPolicy
+{
+    /**
+     * @brief The vector counts as underused while size < capacity / shrink_divisor.
+     */
+    size_t shrink_divisor = 4;
+
+    /**
+     * @brief Number of consecutive operations the vector must stay underused before it shrinks.
+     */
+    size_t patience = 16;
+
+    /**
+     * @brief The capacity is never reduced below this value by the policy.
+     */
+    size_t min_capacity = 16;
+};
+
+/**
+ * @brief Interface of objects whose spare memory can be released on request.
+ */
+class Trimmable
+{
+public:
+    /**
+     * @brief Returns the number of bytes trim() would release.
+     */
+    virtual size_t reclaimable_bytes() const = 0;
+
+    /**
+     * @brief Releases spare memory.
+     *
+     * @return The number of bytes released.
+     */
+    virtual size_t trim() = 0;
+
+protected:
+    Trimmable() = default;
+
+    /**
+     * @brief Copies don't inherit the registration of the original.
+     */
+    Trimmable(const Trimmable&) noexcept {}
+
+    Trimmable& operator=(const Trimmable&) noexcept
+    {
+        return *this;
+    }
+
+    ~Trimmable() = default;
+
+private:
+    friend class TrimRegistry;
+
+    /**
+     * @brief Links of the registry's intrusive list, so registering never allocates.
+     */
+    Trimmable* m_previous = nullptr;
+    Trimmable* m_next = nullptr;
+    bool m_registered = false;
+};
+
+/**
+ * @brief Process-wide list of objects that may be trimmed under memory pressure.
+ *
+ * Registration is thread-safe. trim_all() modifies the registered objects, so
+ * it must be called when none of them is being used by another thread.
+ */
+class TrimRegistry
+{
+private:
+    mutable std::mutex m_mutex;
+
+    /**
+     * @brief First object of the intrusive list of registered objects.
+     */
+    Trimmable* m_head = nullptr;
+    size_t m_count = 0;
+
+    TrimRegistry() = default;
+
+public:
+    TrimRegistry(const TrimRegistry&) = delete;
+    TrimRegistry& operator=(const TrimRegistry&) = delete;
+
+    /**
+     * @brief Returns the registry of the process.
+     */
+    static TrimRegistry& instance()
+    {
+        static TrimRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief Adds an object to the registry. Does nothing if it is already registered.
+     *
+     * Doesn't allocate, so it can be called from noexcept move constructors.
+     */
+    void add(Trimmable* entry) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (entry->m_registered)
+        {
+            return;
+        }
+        entry->m_previous = nullptr;
+        entry->m_next = m_head;
+        if (m_head != nullptr)
+        {
+            m_head->m_previous = entry;
+        }
+        m_head = entry;
+        entry->m_registered = true;
+        ++m_count;
+    }
+
+    /**
+     * @brief Removes an object from the registry. Does nothing if it is not registered.
+     */
+    void remove(Trimmable* entry) noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!entry->m_registered)
+        {
+            return;
+        }
+        if (entry->m_previous != nullptr)
+        {
+            entry->m_previous->m_next = entry->m_next;
+        }
+        else
+        {
+            m_head = entry->m_next;
+        }
+        if (entry->m_next != nullptr)
+        {
+            entry->m_next->m_previous = entry->m_previous;
+        }
+        entry->m_previous = nullptr;
+        entry->m_next = nullptr;
+        entry->m_registered = false;
+        --m_count;
+    }
+
+    /**
+     * @brief Returns the number of registered objects.
+     */
+    size_t getSize() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_count;
+    }
+
+    /**
+     * @brief Returns the number of bytes all registered objects could release.
+     */
+    size_t reclaimable_bytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t total = 0;
+        for (Trimmable* entry = m_head; entry != nullptr; entry = entry->m_next)
+        {
+            total += entry->reclaimable_bytes();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Trims registered objects, largest reclaimable first, until enough memory is released.
+     *
+     * @param bytes_target The number of bytes to release; pass SIZE_MAX to trim everything.
+     * @return The number of bytes actually released.
+     */
+    size_t trim_all(size_t bytes_target)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Vector<std::pair<size_t, Trimmable*>> candidates(m_count);
+        for (Trimmable* entry = m_head; entry != nullptr; entry = entry->m_next)
+        {
+            size_t bytes = entry->reclaimable_bytes();
+            if (bytes != 0)
+            {
+                candidates.push_back({bytes, entry});
+            }
+        }
+        std::sort(candidates.data(), candidates.data() + candidates.getSize(),
+                  [](const auto& a, const auto& b) { return a.first > b.first; });
+
+        size_t released = 0;
+        for (size_t i = 0; i < candidates.getSize() && released < bytes_target; ++i)
+        {
+            released += candidates[i].second->trim();
+        }
+        return released;
+    }
+};
+
+/**
+ * @brief Trims the registered objects of the process until bytes_target bytes are released.
+ *
+ * @see TrimRegistry::trim_all
+ */
+inline size_t trim_all(size_t bytes_target)
+{
+    return TrimRegistry::instance().trim_all(bytes_target);
+}
+
+
+/**
+ * @brief Vector that releases memory automatically according to a ShrinkPolicy.
+ *
+ * Every operation checks whether the vector is underused, and after the policy's
+ * number of consecutive underused operations the capacity is reduced to twice the
+ * size (but not below min_capacity), leaving room to grow without reallocating.
+ *
+ * The elements live in a Vector member rather than a Vector base, so every
+ * operation that changes the size goes through the policy; values() gives
+ * read-only access to the underlying Vector for code that takes one.
+ *
+ * Optionally the vector registers itself in the TrimRegistry, so trim_all() can
+ * release its spare capacity under memory pressure.
+ *
+ * @tparam T The type of elements stored in the vector.
+ */
+template<typename T>
+class ShrinkingVector : public Trimmable
+{
+private:
+    Vector<T> m_values;
+
+    ShrinkPolicy m_policy;
+
+    /**
+     * @brief Number of consecutive operations after which the vector was underused.
+     */
+    size_t m_underused_streak;
+
+    /**
+     * @brief Whether the vector is registered in the TrimRegistry.
+     */
+    bool m_trim_eligible;
+
+    /**
+     * @brief Updates the underuse streak and shrinks the vector when the policy says so.
+     */
+    void apply_policy();
+
+    /**
+     * @brief Registers or unregisters the vector in the TrimRegistry.
+     */
+    void set_trim_eligible(bool trim_eligible) noexcept;
+
+public:
+    using Iterator = typename Vector<T>::Iterator;
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /**
+     * @brief Constructor: Initializes an empty vector.
+     *
+     * @param policy The shrink policy.
+     * @param trim_eligible Whether to register the vector for trim_all().
+     */
+    explicit ShrinkingVector(ShrinkPolicy policy = ShrinkPolicy(), bool trim_eligible = false);
+
+    ShrinkingVector(const ShrinkingVector& other);
+    ShrinkingVector(ShrinkingVector&& other) noexcept;
+    ShrinkingVector& operator=(const ShrinkingVector& other);
+    ShrinkingVector& operator=(ShrinkingVector&& other) noexcept;
+
+    /**
+     * @brief Destructor: Unregisters the vector and frees memory.
+     */
+    ~ShrinkingVector();
+
+    size_t getSize() const { return m_values.getSize(); }
+    size_t getCapacity() const { return m_values.getCapacity(); }
+    bool empty() const { return m_values.empty(); }
+
+    T& operator[](size_t index) { return m_values[index]; }
+    const T& operator[](size_t index) const { return m_values[index]; }
+    T& at(size_t index) { return m_values.at(index); }
+    const T& at(size_t index) const { return m_values.at(index); }
+    T* data() { return m_values.data(); }
+    const T* data() const { return m_values.data(); }
+
+    Iterator begin() { return m_values.begin(); }
+    Iterator end() { return m_values.end(); }
+    ConstIterator begin() const { return m_values.begin(); }
+    ConstIterator end() const { return m_values.end(); }
+
+    /**
+     * @brief Returns the underlying vector for reading.
+     */
+    const Vector<T>& values() const { return m_values; }
+
+    void push_back(const T& value);
+    void push_back(T&& value);
+    void pop_back();
+    void insert(size_t index, const T& value);
+    void insert_batch(Vector<std::pair<size_t, T>> batch);
+    void erase(size_t index);
+    void resize(size_t new_size, const T& value = T());
+    void assign(size_t count, const T& value);
+    void reserve(size_t new_capacity);
+    void shrink_to_fit();
+
+    /**
+     * @brief Removes all elements. The memory is released once the policy allows it.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the policy of the vector.
+     */
+    const ShrinkPolicy& policy() const;
+
+    size_t reclaimable_bytes() const override;
+
+    /**
+     * @brief Reduces the capacity to the current size.
+     *
+     * @return The number of bytes released.
+     */
+    size_t trim() override;
+};
+
+template <typename T>
+ShrinkingVector<T>::ShrinkingVector(ShrinkPolicy policy, bool trim_eligible)
+    : m_values(), m_policy(policy), m_underused_streak(0), m_trim_eligible(trim_eligible)
+{
+    if (m_trim_eligible)
+    {
+        TrimRegistry::instance().add(this);
+    }
+}
+
+template <typename T>
+ShrinkingVector<T>::ShrinkingVector(const ShrinkingVector& other)
+    : Trimmable(other), m_values(other.m_values), m_policy(other.m_policy), m_underused_streak(0),
+      m_trim_eligible(other.m_trim_eligible)
+{
+    if (m_trim_eligible)
+    {
+        TrimRegistry::instance().add(this);
+    }
+}
+
+template <typename T>
+ShrinkingVector<T>::ShrinkingVector(ShrinkingVector&& other) noexcept
+    : Trimmable(other), m_values(std::move(other.m_values)), m_policy(other.m_policy), m_underused_streak(0),
+      m_trim_eligible(other.m_trim_eligible)
+{
+    if (m_trim_eligible)
+    {
+        TrimRegistry::instance().add(this);
+    }
+}
+
+template <typename T>
+ShrinkingVector<T>& ShrinkingVector<T>::operator=(const ShrinkingVector& other)
+{
+    m_values = other.m_values;
+    m_policy = other.m_policy;
+    m_underused_streak = 0;
+    set_trim_eligible(other.m_trim_eligible);
+    return *this;
+}
+
+template <typename T>
+ShrinkingVector<T>& ShrinkingVector<T>::operator=(ShrinkingVector&& other) noexcept
+{
+    m_values = std::move(other.m_values);
+    m_policy = other.m_policy;
+    m_underused_streak = 0;
+    set_trim_eligible(other.m_trim_eligible);
+    return *this;
+}
+
+template <typename T>
+ShrinkingVector<T>::~ShrinkingVector()
+{
+    if (m_trim_eligible)
+    {
+        TrimRegistry::instance().remove(this);
+    }
+}
+
+template <typename T>
+void ShrinkingVector<T>::set_trim_eligible(bool trim_eligible) noexcept
+{
+    if (trim_eligible == m_trim_eligible)
+    {
+        return;
+    }
+    m_trim_eligible = trim_eligible;
+    if (trim_eligible)
+    {
+        TrimRegistry::instance().add(this);
+    }
+    else
+    {
+        TrimRegistry::instance().remove(this);
+    }
+}
+
+template <typename T>
+void ShrinkingVector<T>::apply_policy()
+{
+    size_t size = m_values.getSize();
+    size_t capacity = m_values.getCapacity();
+    size_t divisor = m_policy.shrink_divisor == 0 ? 1 : m_policy.shrink_divisor;
+
+    if (capacity <= m_policy.min_capacity || size >= capacity / divisor)
+    {
+        m_underused_streak = 0;
+        return;
+    }
+
+    if (++m_underused_streak < m_policy.patience)
+    {
+        return;
+    }
+
+    m_underused_streak = 0;
+    m_values.shrink_to(std::max(size * 2, m_policy.min_capacity));
+}
+
+template <typename T>
+void ShrinkingVector<T>::push_back(const T& value)
+{
+    m_values.push_back(value);
+    apply_policy();
+}
+
+template <typename T>
+void ShrinkingVector<T>::push_back(T&& value)
+{
+    m_values.push_back(std::move(value));
+    apply_policy();
+}
+
+template <typename T>
+void ShrinkingVector<T>::pop_back()
+{
+    m_values.pop_back();
+    apply_policy();
+}
+
+template <typename T>
+void ShrinkingVector<T>::insert(size_t index, const T& value)
+{
+    m_values.insert(index, value);
+    apply_policy();
+}
+
+template <typename T>
+void ShrinkingVector<T>::insert_batch(Vector<std::pair<size_t, T>> batch)
+{
+    m_values.insert_batch(std::move(batch));
+    apply_policy();
+}
+
+template <typename T>
+void ShrinkingVector<T>::erase(size_t index)
+{
+    m_values.erase(index);
+    apply_policy();
+}
+
+template <typename T>
+void ShrinkingVector<T>::resize(size_t new_size, const T& value)
+{
+    m_values.resize(new_size, value);
+    apply_policy();
+}
+
+template <typename T>
+void ShrinkingVector<T>::assign(size_t count, const T& value)
+{
+    m_values.assign(count, value);
+    apply_policy();
+}
+
+template <typename T>
+void ShrinkingVector<T>::reserve(size_t new_capacity)
+{
+    // An explicit reservation is a request for room; the streak starts over.
+    m_values.reserve(new_capacity);
+    m_underused_streak = 0;
+}
+
+template <typename T>
+void ShrinkingVector<T>::shrink_to_fit()
+{
+    m_values.shrink_to_fit();
+    m_underused_streak = 0;
+}
+
+template <typename T>
+void ShrinkingVector<T>::clear()
+{
+    m_values.clear();
+    apply_policy();
+}
+
+template <typename T>
+const ShrinkPolicy& ShrinkingVector<T>::policy() const
+{
+    return m_policy;
+}
+
+template <typename T>
+size_t ShrinkingVector<T>::reclaimable_bytes() const
+{
+    return (m_values.getCapacity() - m_values.getSize()) * sizeof(T);
+}
+
+template <typename T>
+size_t ShrinkingVector<T>::trim()
+{
+    size_t released = reclaimable_bytes();
+    m_values.shrink_to_fit();
+    m_underused_streak = 0;
+    return released;
+}
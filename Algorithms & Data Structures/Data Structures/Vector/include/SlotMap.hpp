@@ -0,0 +1,363 @@
+#pragma once
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include "Vector.hpp"
+
+/**
+ * @brief Stable identifier of an element in a SlotMap.
+ *
+ * The generation is bumped every time a slot is reused, so a handle to a
+ * removed element never matches the element that takes its place later.
+ */
+struct SlotHandle
+{
+    uint32_t index = 0;
+    uint32_t generation = 0;
+
+    bool operator==(const SlotHandle& other) const
+    {
+        return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const SlotHandle& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @brief Container with stable handles over densely packed elements.
+ *
+ * Elements are stored contiguously in a Vector, so iterating over all of them
+ * is as fast as iterating over a plain Vector. Handles point into a separate
+ * slot table that records where each element currently is. Removal moves the
+ * last element into the freed position and updates its slot, so insert,
+ * remove and lookup are O(1) and no tombstones are left behind.
+ *
+ * Iteration order is not stable: it changes when elements are removed.
+ *
+ * @tparam T The type of elements stored in the map.
+ */
+template<typename T>
+class SlotMap
+{
+private:
+    /**
+     * @brief Entry of the slot table.
+     *
+     * While the slot is in use, target is the position of the element in m_values.
+     * While it is free, target is the index of the next free slot.
+     */
+    struct Slot
+    {
+        uint32_t target = 0;
+        uint32_t generation = 0;
+    };
+
+    static constexpr uint32_t kNoFreeSlot = UINT32_MAX;
+
+    /**
+     * @brief Densely packed elements.
+     */
+    Vector<T> m_values;
+
+    /**
+     * @brief For every element in m_values, the index of the slot that refers to it.
+     */
+    Vector<uint32_t> m_owners;
+
+    /**
+     * @brief Slot table indexed by SlotHandle::index.
+     */
+    Vector<Slot> m_slots;
+
+    /**
+     * @brief Head of the free slot list, or kNoFreeSlot.
+     */
+    uint32_t m_free_head;
+
+    /**
+     * @brief Returns the position of the element in m_values, or m_values.getSize() if the handle is stale.
+     */
+    size_t position_of(SlotHandle handle) const;
+
+    /**
+     * @brief Takes a slot from the free list or adds a new one and points it at the last element.
+     */
+    SlotHandle acquire_slot();
+
+public:
+    using Iterator = typename Vector<T>::Iterator;
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /**
+     * @brief Default constructor: Initializes an empty map.
+     */
+    SlotMap();
+
+    /**
+     * @brief Returns the number of stored elements.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Checks if the map is empty.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Adds an element.
+     *
+     * @param value The value to be added.
+     * @return Handle that identifies the element until it is removed.
+     */
+    SlotHandle insert(const T& value);
+
+    /**
+     * @brief Adds an element using move semantics.
+     *
+     * @param value The value to be added.
+     * @return Handle that identifies the element until it is removed.
+     */
+    SlotHandle insert(T&& value);
+
+    /**
+     * @brief Removes an element.
+     *
+     * @param handle The handle of the element.
+     * @return True if the element was removed, false if the handle is stale.
+     */
+    bool remove(SlotHandle handle);
+
+    /**
+     * @brief Checks if the handle refers to a stored element.
+     */
+    bool contains(SlotHandle handle) const;
+
+    /**
+     * @brief Looks up an element.
+     *
+     * @param handle The handle of the element.
+     * @return Pointer to the element, or nullptr if the handle is stale.
+     */
+    T* get(SlotHandle handle);
+
+    /**
+     * @brief Const version get().
+     */
+    const T* get(SlotHandle handle) const;
+
+    /**
+     * @brief Access to an element with handle checking.
+     *
+     * @param handle The handle of the element.
+     * @return Reference to the element.
+     * @throw std::out_of_range If the handle is stale.
+     */
+    T& at(SlotHandle handle);
+
+    /**
+     * @brief Const version at().
+     *
+     * @throw std::out_of_range If the handle is stale.
+     */
+    const T& at(SlotHandle handle) const;
+
+    /**
+     * @brief Returns the handle of the element at a position of the dense storage.
+     *
+     * @param index The position of the element, as seen during iteration.
+     */
+    SlotHandle handle_at(size_t index) const;
+
+    /**
+     * @brief Pre-allocation of memory for elements and slots.
+     */
+    void reserve(size_t new_capacity);
+
+    /**
+     * @brief Removes all elements. All handles become stale.
+     */
+    void clear();
+
+    Iterator begin() { return m_values.begin(); }
+    Iterator end() { return m_values.end(); }
+    ConstIterator begin() const { return m_values.begin(); }
+    ConstIterator end() const { return m_values.end(); }
+    ConstIterator cbegin() const { return m_values.cbegin(); }
+    ConstIterator cend() const { return m_values.cend(); }
+};
+
+template <typename T>
+SlotMap<T>::SlotMap() : m_free_head(kNoFreeSlot)
+{
+    // Initialize an empty map.
+}
+
+template <typename T>
+size_t SlotMap<T>::getSize() const
+{
+    return m_values.getSize();
+}
+
+template <typename T>
+bool SlotMap<T>::empty() const
+{
+    return m_values.empty();
+}
+
+template <typename T>
+size_t SlotMap<T>::position_of(SlotHandle handle) const
+{
+    if (handle.index >= m_slots.getSize())
+    {
+        return m_values.getSize();
+    }
+
+    const Slot& slot = m_slots[handle.index];
+    if (slot.generation != handle.generation || slot.target >= m_values.getSize()
+        || m_owners[slot.target] != handle.index)
+    {
+        return m_values.getSize();
+    }
+    return slot.target;
+}
+
+template <typename T>
+SlotHandle SlotMap<T>::acquire_slot()
+{
+    uint32_t position = static_cast<uint32_t>(m_values.getSize() - 1);
+    uint32_t index;
+
+    if (m_free_head != kNoFreeSlot)
+    {
+        index = m_free_head;
+        m_free_head = m_slots[index].target;
+    }
+    else
+    {
+        if (m_slots.getSize() >= kNoFreeSlot)
+        {
+            m_values.pop_back();
+            throw std::length_error("SlotMap slot limit exceeded");
+        }
+        index = static_cast<uint32_t>(m_slots.getSize());
+        m_slots.push_back(Slot());
+    }
+
+    m_slots[index].target = position;
+    m_owners.push_back(index);
+    return SlotHandle{index, m_slots[index].generation};
+}
+
+template <typename T>
+SlotHandle SlotMap<T>::insert(const T& value)
+{
+    m_values.push_back(value);
+    return acquire_slot();
+}
+
+template <typename T>
+SlotHandle SlotMap<T>::insert(T&& value)
+{
+    m_values.push_back(std::move(value));
+    return acquire_slot();
+}
+
+template <typename T>
+bool SlotMap<T>::remove(SlotHandle handle)
+{
+    size_t position = position_of(handle);
+    if (position == m_values.getSize())
+    {
+        return false;
+    }
+
+    size_t last = m_values.getSize() - 1;
+    if (position != last)
+    {
+        m_values[position] = std::move(m_values[last]);
+        m_owners[position] = m_owners[last];
+        m_slots[m_owners[position]].target = static_cast<uint32_t>(position);
+    }
+    m_values.pop_back();
+    m_owners.pop_back();
+
+    Slot& slot = m_slots[handle.index];
+    ++slot.generation;
+    slot.target = m_free_head;
+    m_free_head = handle.index;
+    return true;
+}
+
+template <typename T>
+bool SlotMap<T>::contains(SlotHandle handle) const
+{
+    return position_of(handle) != m_values.getSize();
+}
+
+template <typename T>
+T* SlotMap<T>::get(SlotHandle handle)
+{
+    size_t position = position_of(handle);
+    return position == m_values.getSize() ? nullptr : &m_values[position];
+}
+
+template <typename T>
+const T* SlotMap<T>::get(SlotHandle handle) const
+{
+    size_t position = position_of(handle);
+    return position == m_values.getSize() ? nullptr : &m_values[position];
+}
+
+template <typename T>
+T& SlotMap<T>::at(SlotHandle handle)
+{
+    T* value = get(handle);
+    if (value == nullptr)
+    {
+        throw std::out_of_range("Stale slot handle");
+    }
+    return *value;
+}
+
+template <typename T>
+const T& SlotMap<T>::at(SlotHandle handle) const
+{
+    const T* value = get(handle);
+    if (value == nullptr)
+    {
+        throw std::out_of_range("Stale slot handle");
+    }
+    return *value;
+}
+
+template <typename T>
+SlotHandle SlotMap<T>::handle_at(size_t index) const
+{
+    uint32_t slot = m_owners.at(index);
+    return SlotHandle{slot, m_slots[slot].generation};
+}
+
+template <typename T>
+void SlotMap<T>::reserve(size_t new_capacity)
+{
+    m_values.reserve(new_capacity);
+    m_owners.reserve(new_capacity);
+    m_slots.reserve(new_capacity);
+}
+
+template <typename T>
+void SlotMap<T>::clear()
+{
+    for (size_t i = 0; i < m_owners.getSize(); ++i)
+    {
+        Slot& slot = m_slots[m_owners[i]];
+        ++slot.generation;
+        slot.target = m_free_head;
+        m_free_head = m_owners[i];
+    }
+    m_values.clear();
+    m_owners.clear();
+}
@@ -0,0 +1,822 @@
+/*
+ * The pdqsort implementation in this file (sort_detail::insertion_sort through
+ * sort_detail::pdqsort_loop) is derived from pdqsort.h by Orson Peters and is
+ * distributed under the zlib license below. It has been modified: ported from
+ * iterators to raw pointers into a Vector, restyled, and selected automatically
+ * for branchless partitioning. The rest of this file is under the project's MIT
+ * license.
+ *
+ * pdqsort.h - Pattern-defeating quicksort.
+ *
+ * Copyright (c) 2021 Orson Peters
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ *
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as
+ *    being the original software.
+ *
+ * 3. This notice may not be removed or altered from any source distribution.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "Parallel.hpp"
+#include "Vector.hpp"
+
+/**
+ * @file Sort.hpp
+ * @brief Sorting algorithms for Vector.
+ *
+ * - sort(): pattern-defeating quicksort (pdqsort), a modified version of Orson
+ *   Peters' pdqsort (see the notice at the top). O(n log n) worst case, linear
+ *   on sorted and reverse-sorted input. Not stable. For arithmetic types compared
+ *   with std::less / std::greater the partitioning step is branchless.
+ * - radix_sort(): LSD radix sort on integer and floating-point keys. Stable.
+ * - parallel_radix_sort(): the same algorithm split across threads. Stable.
+ */
+
+namespace sort_detail
+{
+    // Tuning constants and the functions up to pdqsort_loop follow pdqsort.h (zlib license, see above).
+    constexpr std::ptrdiff_t kInsertionSortThreshold = 24;
+    constexpr std::ptrdiff_t kNintherThreshold = 128;
+    constexpr size_t kPartialInsertionSortLimit = 8;
+    constexpr std::ptrdiff_t kBlockSize = 64;
+    constexpr size_t kParallelThreshold = 65536;
+
+    /**
+     * @brief True if comparisons of T with Compare are cheap and free of side effects,
+     *        which makes the branchless partition profitable.
+     */
+    template<typename T, typename Compare>
+    struct is_default_compare : std::integral_constant<bool, std::is_arithmetic_v<T> && (
+        std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::less<>> ||
+        std::is_same_v<Compare, std::greater<T>> || std::is_same_v<Compare, std::greater<>>)> {};
+
+    template<typename T, typename Compare>
+    void insertion_sort(T* begin, T* end, Compare& comp)
+    {
+        if (begin == end)
+        {
+            return;
+        }
+        for (T* cur = begin + 1; cur != end; ++cur)
+        {
+            T* sift = cur;
+            T* sift_1 = cur - 1;
+            if (comp(*sift, *sift_1))
+            {
+                T tmp = std::move(*sift);
+                do
+                {
+                    *sift-- = std::move(*sift_1);
+                } while (sift != begin && comp(tmp, *--sift_1));
+                *sift = std::move(tmp);
+            }
+        }
+    }
+
+    /**
+     * @brief Insertion sort that relies on *(begin - 1) not being greater than any element.
+     */
+    template<typename T, typename Compare>
+    void unguarded_insertion_sort(T* begin, T* end, Compare& comp)
+    {
+        if (begin == end)
+        {
+            return;
+        }
+        for (T* cur = begin + 1; cur != end; ++cur)
+        {
+            T* sift = cur;
+            T* sift_1 = cur - 1;
+            if (comp(*sift, *sift_1))
+            {
+                T tmp = std::move(*sift);
+                do
+                {
+                    *sift-- = std::move(*sift_1);
+                } while (comp(tmp, *--sift_1));
+                *sift = std::move(tmp);
+            }
+        }
+    }
+
+    /**
+     * @brief Insertion sort that gives up after a few moves.
+     *
+     * @return True if the range was sorted, false if it gave up.
+     */
+    template<typename T, typename Compare>
+    bool partial_insertion_sort(T* begin, T* end, Compare& comp)
+    {
+        if (begin == end)
+        {
+            return true;
+        }
+        size_t moved = 0;
+        for (T* cur = begin + 1; cur != end; ++cur)
+        {
+            T* sift = cur;
+            T* sift_1 = cur - 1;
+            if (comp(*sift, *sift_1))
+            {
+                T tmp = std::move(*sift);
+                do
+                {
+                    *sift-- = std::move(*sift_1);
+                } while (sift != begin && comp(tmp, *--sift_1));
+                *sift = std::move(tmp);
+                moved += static_cast<size_t>(cur - sift);
+            }
+            if (moved > kPartialInsertionSortLimit)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename T, typename Compare>
+    void sort2(T* a, T* b, Compare& comp)
+    {
+        if (comp(*b, *a))
+        {
+            std::iter_swap(a, b);
+        }
+    }
+
+    template<typename T, typename Compare>
+    void sort3(T* a, T* b, T* c, Compare& comp)
+    {
+        sort2(a, b, comp);
+        sort2(b, c, comp);
+        sort2(a, b, comp);
+    }
+
+    template<typename T>
+    void swap_offsets(T* first, T* last, const unsigned char* offsets_l, const unsigned char* offsets_r,
+                      std::ptrdiff_t count, bool use_swaps)
+    {
+        if (use_swaps)
+        {
+            // Equal numbers of misplaced elements on both sides: plain swaps keep the order.
+            for (std::ptrdiff_t i = 0; i < count; ++i)
+            {
+                std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+            }
+        }
+        else if (count > 0)
+        {
+            // Otherwise a cyclic permutation needs fewer moves than swaps.
+            T* l = first + offsets_l[0];
+            T* r = last - offsets_r[0];
+            T tmp(std::move(*l));
+            *l = std::move(*r);
+            for (std::ptrdiff_t i = 1; i < count; ++i)
+            {
+                l = first + offsets_l[i];
+                *r = std::move(*l);
+                r = last - offsets_r[i];
+                *l = std::move(*r);
+            }
+            *r = std::move(tmp);
+        }
+    }
+
+    /**
+     * @brief Partitions around *begin into [< pivot) pivot [>= pivot).
+     *
+     * Uses BlockQuicksort: the positions of misplaced elements are collected into
+     * small offset buffers without branching on the comparison result, and then
+     * swapped in bulk.
+     *
+     * @return The position of the pivot and whether the range was already partitioned.
+     */
+    template<typename T, typename Compare>
+    std::pair<T*, bool> partition_right_branchless(T* begin, T* end, Compare& comp)
+    {
+        T pivot(std::move(*begin));
+        T* first = begin;
+        T* last = end;
+
+        // The median-of-3 guarantees an element >= pivot at the end of the range.
+        while (comp(*++first, pivot));
+
+        if (first - 1 == begin)
+        {
+            while (first < last && !comp(*--last, pivot));
+        }
+        else
+        {
+            while (!comp(*--last, pivot));
+        }
+
+        bool already_partitioned = first >= last;
+        if (!already_partitioned)
+        {
+            std::iter_swap(first, last);
+            ++first;
+
+            alignas(64) unsigned char offsets_l_storage[kBlockSize];
+            alignas(64) unsigned char offsets_r_storage[kBlockSize];
+            unsigned char* offsets_l = offsets_l_storage;
+            unsigned char* offsets_r = offsets_r_storage;
+
+            T* offsets_l_base = first;
+            T* offsets_r_base = last;
+            std::ptrdiff_t num_l = 0;
+            std::ptrdiff_t num_r = 0;
+            std::ptrdiff_t start_l = 0;
+            std::ptrdiff_t start_r = 0;
+
+            while (first < last)
+            {
+                // Fill the offset blocks that are empty, splitting the unknown elements if both are.
+                std::ptrdiff_t num_unknown = last - first;
+                std::ptrdiff_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                std::ptrdiff_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+                if (left_split >= kBlockSize)
+                {
+                    for (std::ptrdiff_t i = 0; i < kBlockSize;)
+                    {
+                        offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                        offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                        offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                        offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                    }
+                }
+                else
+                {
+                    for (std::ptrdiff_t i = 0; i < left_split;)
+                    {
+                        offsets_l[num_l] = static_cast<unsigned char>(i++); num_l += !comp(*first, pivot); ++first;
+                    }
+                }
+
+                if (right_split >= kBlockSize)
+                {
+                    for (std::ptrdiff_t i = 0; i < kBlockSize;)
+                    {
+                        offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                        offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                        offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                        offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                    }
+                }
+                else
+                {
+                    for (std::ptrdiff_t i = 0; i < right_split;)
+                    {
+                        offsets_r[num_r] = static_cast<unsigned char>(++i); num_r += comp(*--last, pivot);
+                    }
+                }
+
+                std::ptrdiff_t count = std::min(num_l, num_r);
+                swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r,
+                             count, num_l == num_r);
+                num_l -= count;
+                num_r -= count;
+                start_l += count;
+                start_r += count;
+
+                if (num_l == 0)
+                {
+                    start_l = 0;
+                    offsets_l_base = first;
+                }
+                if (num_r == 0)
+                {
+                    start_r = 0;
+                    offsets_r_base = last;
+                }
+            }
+
+            // At most one block still has misplaced elements; move them to the boundary.
+            if (num_l)
+            {
+                offsets_l += start_l;
+                while (num_l--)
+                {
+                    std::iter_swap(offsets_l_base + offsets_l[num_l], --last);
+                }
+                first = last;
+            }
+            if (num_r)
+            {
+                offsets_r += start_r;
+                while (num_r--)
+                {
+                    std::iter_swap(offsets_r_base - offsets_r[num_r], first);
+                    ++first;
+                }
+                last = first;
+            }
+        }
+
+        T* pivot_pos = first - 1;
+        *begin = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+        return std::make_pair(pivot_pos, already_partitioned);
+    }
+
+    /**
+     * @brief Partitions around *begin into [< pivot) pivot [>= pivot) with classic Hoare scans.
+     *
+     * @return The position of the pivot and whether the range was already partitioned.
+     */
+    template<typename T, typename Compare>
+    std::pair<T*, bool> partition_right(T* begin, T* end, Compare& comp)
+    {
+        T pivot(std::move(*begin));
+        T* first = begin;
+        T* last = end;
+
+        while (comp(*++first, pivot));
+
+        if (first - 1 == begin)
+        {
+            while (first < last && !comp(*--last, pivot));
+        }
+        else
+        {
+            while (!comp(*--last, pivot));
+        }
+
+        bool already_partitioned = first >= last;
+        while (first < last)
+        {
+            std::iter_swap(first, last);
+            while (comp(*++first, pivot));
+            while (!comp(*--last, pivot));
+        }
+
+        T* pivot_pos = first - 1;
+        *begin = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+        return std::make_pair(pivot_pos, already_partitioned);
+    }
+
+    /**
+     * @brief Partitions into [<= pivot) pivot [> pivot). Used when many elements equal the pivot,
+     *        which then all end up on the left and are never touched again.
+     */
+    template<typename T, typename Compare>
+    T* partition_left(T* begin, T* end, Compare& comp)
+    {
+        T pivot(std::move(*begin));
+        T* first = begin;
+        T* last = end;
+
+        while (comp(pivot, *--last));
+
+        if (last + 1 == end)
+        {
+            while (first < last && !comp(pivot, *++first));
+        }
+        else
+        {
+            while (!comp(pivot, *++first));
+        }
+
+        while (first < last)
+        {
+            std::iter_swap(first, last);
+            while (comp(pivot, *--last));
+            while (!comp(pivot, *++first));
+        }
+
+        T* pivot_pos = last;
+        *begin = std::move(*pivot_pos);
+        *pivot_pos = std::move(pivot);
+        return pivot_pos;
+    }
+
+    template<bool Branchless, typename T, typename Compare>
+    void pdqsort_loop(T* begin, T* end, Compare& comp, int bad_allowed, bool leftmost)
+    {
+        while (true)
+        {
+            std::ptrdiff_t size = end - begin;
+
+            if (size < kInsertionSortThreshold)
+            {
+                if (leftmost)
+                {
+                    insertion_sort(begin, end, comp);
+                }
+                else
+                {
+                    unguarded_insertion_sort(begin, end, comp);
+                }
+                return;
+            }
+
+            // Pivot: median of 3, or pseudo-median of 9 (Tukey's ninther) for larger ranges.
+            std::ptrdiff_t s2 = size / 2;
+            if (size > kNintherThreshold)
+            {
+                sort3(begin, begin + s2, end - 1, comp);
+                sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+                sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+                sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+                std::iter_swap(begin, begin + s2);
+            }
+            else
+            {
+                sort3(begin + s2, begin, end - 1, comp);
+            }
+
+            // If the element before this range equals the pivot, all elements equal to it go left.
+            if (!leftmost && !comp(*(begin - 1), *begin))
+            {
+                begin = partition_left(begin, end, comp) + 1;
+                continue;
+            }
+
+            std::pair<T*, bool> result = Branchless ? partition_right_branchless(begin, end, comp)
+                                                    : partition_right(begin, end, comp);
+            T* pivot_pos = result.first;
+            bool already_partitioned = result.second;
+
+            std::ptrdiff_t l_size = pivot_pos - begin;
+            std::ptrdiff_t r_size = end - (pivot_pos + 1);
+            bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+            if (highly_unbalanced)
+            {
+                // Too many bad partitions: fall back to heapsort for a guaranteed O(n log n).
+                if (--bad_allowed == 0)
+                {
+                    std::make_heap(begin, end, comp);
+                    std::sort_heap(begin, end, comp);
+                    return;
+                }
+
+                // Shuffle some elements to break patterns that produce bad pivots.
+                if (l_size >= kInsertionSortThreshold)
+                {
+                    std::iter_swap(begin, begin + l_size / 4);
+                    std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                    if (l_size > kNintherThreshold)
+                    {
+                        std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                        std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                        std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                        std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                    }
+                }
+                if (r_size >= kInsertionSortThreshold)
+                {
+                    std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                    std::iter_swap(end - 1, end - r_size / 4);
+                    if (r_size > kNintherThreshold)
+                    {
+                        std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                        std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                        std::iter_swap(end - 2, end - (1 + r_size / 4));
+                        std::iter_swap(end - 3, end - (2 + r_size / 4));
+                    }
+                }
+            }
+            else if (already_partitioned && partial_insertion_sort(begin, pivot_pos, comp)
+                     && partial_insertion_sort(pivot_pos + 1, end, comp))
+            {
+                // A well-balanced partition that needed no swaps: the range is likely sorted already.
+                return;
+            }
+
+            // Recurse into the left part, loop on the right one.
+            pdqsort_loop<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+            begin = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+
+    /**
+     * @brief Maps an arithmetic key to an unsigned integer with the same ordering.
+     */
+    template<typename K>
+    auto radix_key(K key)
+    {
+        static_assert(std::is_arithmetic_v<K>, "radix sort keys must be arithmetic");
+
+        if constexpr (std::is_floating_point_v<K>)
+        {
+            using U = std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>;
+            static_assert(sizeof(K) == sizeof(U), "unsupported floating-point type");
+            U bits;
+            std::memcpy(&bits, &key, sizeof(bits));
+            constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+            // Negative numbers: flip all bits; positive numbers: set the sign bit.
+            return (bits & sign) ? static_cast<U>(~bits) : static_cast<U>(bits | sign);
+        }
+        else if constexpr (std::is_same_v<K, bool>)
+        {
+            return static_cast<uint8_t>(key);
+        }
+        else
+        {
+            using U = std::make_unsigned_t<K>;
+            if constexpr (std::is_signed_v<K>)
+            {
+                constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+                return static_cast<U>(static_cast<U>(key) ^ sign);
+            }
+            else
+            {
+                return static_cast<U>(key);
+            }
+        }
+    }
+
+    /**
+     * @brief Element and key position used when records are too heavy to move in every pass.
+     */
+    template<typename U>
+    struct KeyIndex
+    {
+        U key;
+        size_t index;
+    };
+
+    /**
+     * @brief LSD radix sort with 8-bit digits over data, using scratch of the same size.
+     *
+     * Digits in which all keys agree are skipped. Counting and scattering are split
+     * across thread_count threads; every thread keeps its own histogram and writes to
+     * the positions after the elements of the threads before it, which keeps the sort stable.
+     *
+     * @return True if the sorted result ended up in scratch, false if in data.
+     */
+    template<typename T, typename KeyOf>
+    bool lsd_radix_sort(T* data, T* scratch, size_t size, KeyOf&& key_of, size_t thread_count)
+    {
+        using U = decltype(radix_key(key_of(*data)));
+        constexpr size_t kPasses = sizeof(U);
+        constexpr size_t kBuckets = 256;
+
+        // Below this size starting threads costs more than it saves.
+        if (size < kParallelThreshold || thread_count == 0)
+        {
+            thread_count = 1;
+        }
+
+        // One histogram per thread and pass, built in a single read of the data.
+        Vector<size_t> counts;
+        counts.resize(thread_count * kPasses * kBuckets, 0);
+        parallel_for(0, size, thread_count, [&](size_t lo, size_t hi, size_t worker) {
+            size_t* local = counts.data() + worker * kPasses * kBuckets;
+            for (size_t i = lo; i < hi; ++i)
+            {
+                U key = radix_key(key_of(data[i]));
+                for (size_t pass = 0; pass < kPasses; ++pass)
+                {
+                    ++local[pass * kBuckets + ((key >> (pass * 8)) & 0xFF)];
+                }
+            }
+        });
+
+        T* source = data;
+        T* target = scratch;
+        bool in_scratch = false;
+        bool moved = false;
+        Vector<size_t> offsets;
+        offsets.resize(thread_count * kBuckets, 0);
+
+        for (size_t pass = 0; pass < kPasses; ++pass)
+        {
+            // Skip the pass if every key has the same digit here.
+            bool trivial = false;
+            for (size_t bucket = 0; bucket < kBuckets; ++bucket)
+            {
+                size_t total = 0;
+                for (size_t worker = 0; worker < thread_count; ++worker)
+                {
+                    total += counts[(worker * kPasses + pass) * kBuckets + bucket];
+                }
+                if (total == size)
+                {
+                    trivial = true;
+                    break;
+                }
+                if (total != 0)
+                {
+                    break;
+                }
+            }
+            if (trivial)
+            {
+                continue;
+            }
+
+            // The totals per digit survive a pass, but the split between threads does not.
+            if (thread_count > 1 && moved)
+            {
+                parallel_for(0, size, thread_count, [&](size_t lo, size_t hi, size_t worker) {
+                    size_t* local = counts.data() + (worker * kPasses + pass) * kBuckets;
+                    std::fill(local, local + kBuckets, size_t(0));
+                    for (size_t i = lo; i < hi; ++i)
+                    {
+                        ++local[(radix_key(key_of(source[i])) >> (pass * 8)) & 0xFF];
+                    }
+                });
+            }
+
+            size_t position = 0;
+            for (size_t bucket = 0; bucket < kBuckets; ++bucket)
+            {
+                for (size_t worker = 0; worker < thread_count; ++worker)
+                {
+                    offsets[worker * kBuckets + bucket] = position;
+                    position += counts[(worker * kPasses + pass) * kBuckets + bucket];
+                }
+            }
+
+            parallel_for(0, size, thread_count, [&](size_t lo, size_t hi, size_t worker) {
+                size_t* local = offsets.data() + worker * kBuckets;
+                for (size_t i = lo; i < hi; ++i)
+                {
+                    size_t digit = (radix_key(key_of(source[i])) >> (pass * 8)) & 0xFF;
+                    target[local[digit]++] = std::move(source[i]);
+                }
+            });
+
+            std::swap(source, target);
+            in_scratch = !in_scratch;
+            moved = true;
+        }
+        return in_scratch;
+    }
+
+    template<typename T, typename KeyFn>
+    void radix_sort_by_key(Vector<T>& values, KeyFn&& key_fn, size_t thread_count)
+    {
+        size_t size = values.getSize();
+        if (size < 2)
+        {
+            return;
+        }
+
+        using K = std::decay_t<decltype(key_fn(values[0]))>;
+        using U = decltype(radix_key(std::declval<K>()));
+        using Pair = KeyIndex<U>;
+
+        if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(Pair))
+        {
+            // Light records: move them directly in every pass.
+            Vector<T> scratch(size);
+            if (lsd_radix_sort(values.data(), scratch.data(), size,
+                               [&](const T& value) { return key_fn(value); }, thread_count))
+            {
+                std::memcpy(static_cast<void*>(values.data()), scratch.data(), size * sizeof(T));
+            }
+        }
+        else
+        {
+            // Heavy records: sort (key, index) pairs, then move every record once.
+            Vector<Pair> pairs(size);
+            Vector<Pair> scratch(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                pairs.push_back(Pair{radix_key(key_fn(values[i])), i});
+            }
+            Pair* sorted = lsd_radix_sort(pairs.data(), scratch.data(), size,
+                                          [](const Pair& pair) { return pair.key; }, thread_count)
+                               ? scratch.data() : pairs.data();
+
+            // Apply the permutation in place, one cycle at a time, so no third
+            // full-size buffer is needed. Every record is moved once, plus one
+            // temporary per cycle; visited slots are marked by pointing at themselves.
+            for (size_t start = 0; start < size; ++start)
+            {
+                if (sorted[start].index == start)
+                {
+                    continue;
+                }
+                T held = std::move(values[start]);
+                size_t slot = start;
+                while (sorted[slot].index != start)
+                {
+                    size_t from = sorted[slot].index;
+                    values[slot] = std::move(values[from]);
+                    sorted[slot].index = slot;
+                    slot = from;
+                }
+                values[slot] = std::move(held);
+                sorted[slot].index = slot;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sorts a vector with pattern-defeating quicksort. Not stable.
+ *
+ * @param values The vector to sort.
+ * @param comp Strict weak ordering; comp(a, b) is true if a goes before b.
+ */
+template<typename T, typename Compare>
+void sort(Vector<T>& values, Compare comp)
+{
+    size_t size = values.getSize();
+    if (size < 2)
+    {
+        return;
+    }
+
+    int bad_allowed = 0;
+    for (size_t n = size; n > 1; n >>= 1)
+    {
+        ++bad_allowed;
+    }
+
+    T* begin = values.data();
+    sort_detail::pdqsort_loop<sort_detail::is_default_compare<T, Compare>::value>(
+        begin, begin + size, comp, bad_allowed, true);
+}
+
+/**
+ * @brief Sorts a vector in ascending order with pattern-defeating quicksort. Not stable.
+ *
+ * @param values The vector to sort.
+ */
+template<typename T>
+void sort(Vector<T>& values)
+{
+    sort(values, std::less<T>());
+}
+
+/**
+ * @brief Sorts a vector of integers or floating-point numbers in ascending order. Stable.
+ *
+ * Negative floating-point zero goes before positive zero; NaNs go to the ends
+ * depending on their sign bit.
+ *
+ * @param values The vector to sort.
+ */
+template<typename T>
+void radix_sort(Vector<T>& values)
+{
+    static_assert(std::is_arithmetic_v<T>, "radix_sort without a key requires an arithmetic type");
+    sort_detail::radix_sort_by_key(values, [](const T& value) { return value; }, 1);
+}
+
+/**
+ * @brief Sorts records by an integer or floating-point key in ascending order. Stable.
+ *
+ * Large or non-trivially-copyable records are not moved in every pass: (key, index)
+ * pairs are sorted instead, and every record is moved once at the end.
+ *
+ * @param values The vector to sort.
+ * @param key_fn Callable returning the arithmetic key of a record.
+ */
+template<typename T, typename KeyFn>
+void radix_sort(Vector<T>& values, KeyFn key_fn)
+{
+    sort_detail::radix_sort_by_key(values, key_fn, 1);
+}
+
+/**
+ * @brief Multi-threaded radix_sort() of integers or floating-point numbers. Stable.
+ *
+ * Small inputs are sorted on the calling thread.
+ *
+ * @param values The vector to sort.
+ * @param thread_count The number of threads; 0 means default_thread_count().
+ */
+template<typename T>
+void parallel_radix_sort(Vector<T>& values, size_t thread_count = 0)
+{
+    static_assert(std::is_arithmetic_v<T>, "parallel_radix_sort without a key requires an arithmetic type");
+    sort_detail::radix_sort_by_key(values, [](const T& value) { return value; },
+                                   thread_count == 0 ? default_thread_count() : thread_count);
+}
+
+/**
+ * @brief Multi-threaded radix_sort() of records by key. Stable.
+ *
+ * @param values The vector to sort.
+ * @param key_fn Callable returning the arithmetic key of a record.
+ * @param thread_count The number of threads; 0 means default_thread_count().
+ */
+template<typename T, typename KeyFn, typename = std::enable_if_t<std::is_invocable_v<KeyFn&, const T&>>>
+void parallel_radix_sort(Vector<T>& values, KeyFn key_fn, size_t thread_count = 0)
+{
+    sort_detail::radix_sort_by_key(values, key_fn, thread_count == 0 ? default_thread_count() : thread_count);
+}
@@ -0,0 +1,417 @@
+#pragma once
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include "Vector.hpp"
+
+/**
+ * @brief Vector of a fixed logical size that stores only its non-default elements.
+ *
+ * The stored elements are kept as two parallel arrays sorted by position: the
+ * positions in one, the values in the other. Every position that is not stored
+ * holds T(). A column that is 99% zero therefore takes about 1% of the memory of a
+ * dense Vector, and scanning it touches only the stored elements.
+ *
+ * Lookups are binary searches. Setting an element past the last stored position is
+ * an append; setting one in the middle shifts the later entries.
+ *
+ * @tparam T The element type. T() is the implicit value and must be comparable with ==.
+ */
+template<typename T>
+class SparseVector
+{
+private:
+    /**
+     * @brief The logical number of elements.
+     */
+    size_t m_size;
+
+    /**
+     * @brief Positions of the stored elements, strictly increasing.
+     */
+    Vector<size_t> m_indices;
+
+    /**
+     * @brief Values of the stored elements, parallel to m_indices; none equals T().
+     */
+    Vector<T> m_values;
+
+    /**
+     * @brief Returns the slot of the first stored position that is not less than index.
+     */
+    size_t lower_slot(size_t index) const;
+
+public:
+    /**
+     * @brief A stored element as seen by the iterator.
+     */
+    struct Entry
+    {
+        size_t index;
+        const T& value;
+    };
+
+    /**
+     * @brief Iterator over the stored elements in order of position.
+     */
+    class ConstIterator
+    {
+    private:
+        const SparseVector* m_owner;
+        size_t m_slot;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Entry;
+
+        ConstIterator(const SparseVector* owner, size_t slot) : m_owner(owner), m_slot(slot) {}
+
+        Entry operator*() const
+        {
+            return Entry{m_owner->m_indices[m_slot], m_owner->m_values[m_slot]};
+        }
+
+        ConstIterator& operator++()
+        {
+            ++m_slot;
+            return *this;
+        }
+
+        ConstIterator operator++(int)
+        {
+            ConstIterator tmp = *this;
+            ++m_slot;
+            return tmp;
+        }
+
+        bool operator==(const ConstIterator& other) const
+        {
+            return m_slot == other.m_slot;
+        }
+
+        bool operator!=(const ConstIterator& other) const
+        {
+            return m_slot != other.m_slot;
+        }
+    };
+
+    /**
+     * @brief Constructor: Initializes a vector of size elements, all T().
+     *
+     * @param size The logical number of elements.
+     */
+    explicit SparseVector(size_t size = 0);
+
+    /**
+     * @brief Constructor that keeps the non-default elements of a dense vector.
+     *
+     * @param dense The vector to convert.
+     */
+    explicit SparseVector(const Vector<T>& dense);
+
+    /**
+     * @brief Returns the logical number of elements.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Returns the number of stored (non-default) elements.
+     */
+    size_t getNonZeroCount() const;
+
+    /**
+     * @brief Returns the positions of the stored elements in increasing order.
+     */
+    const Vector<size_t>& indices() const;
+
+    /**
+     * @brief Returns the values of the stored elements, parallel to indices().
+     */
+    const Vector<T>& values() const;
+
+    /**
+     * @brief Returns the element at a position without bounds checking.
+     *
+     * @param index The position.
+     * @return The stored value, or T() if nothing is stored there.
+     */
+    T get(size_t index) const;
+
+    /**
+     * @brief Returns the element at a position with bounds checking.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    T at(size_t index) const;
+
+    /**
+     * @brief Sets the element at a position. Setting T() removes the stored element.
+     *
+     * @param index The position.
+     * @param value The new value.
+     * @throw std::out_of_range If the index is out of range.
+     */
+    void set(size_t index, const T& value);
+
+    /**
+     * @brief Changes the logical size. Stored elements at or past the new size are dropped.
+     *
+     * @param new_size The new logical number of elements.
+     */
+    void resize(size_t new_size);
+
+    /**
+     * @brief Reserves room for a number of stored elements.
+     *
+     * @param count The number of stored elements to make room for.
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Removes all stored elements; the logical size doesn't change.
+     */
+    void clear();
+
+    /**
+     * @brief Writes all elements, including the default ones, into a dense vector.
+     *
+     * @param dense Receives getSize() elements.
+     */
+    void to_dense(Vector<T>& dense) const;
+
+    /**
+     * @brief Returns all elements, including the default ones, as a dense vector.
+     */
+    Vector<T> to_dense() const;
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, m_indices.getSize()); }
+};
+
+template <typename T>
+SparseVector<T>::SparseVector(size_t size) : m_size(size), m_indices(), m_values()
+{
+}
+
+template <typename T>
+SparseVector<T>::SparseVector(const Vector<T>& dense) : m_size(dense.getSize()), m_indices(), m_values()
+{
+    const T zero = T();
+    for (size_t i = 0; i < dense.getSize(); ++i)
+    {
+        if (!(dense[i] == zero))
+        {
+            m_indices.push_back(i);
+            m_values.push_back(dense[i]);
+        }
+    }
+}
+
+template <typename T>
+size_t SparseVector<T>::lower_slot(size_t index) const
+{
+    const size_t* first = m_indices.data();
+    return static_cast<size_t>(std::lower_bound(first, first + m_indices.getSize(), index) - first);
+}
+
+template <typename T>
+size_t SparseVector<T>::getSize() const
+{
+    return m_size;
+}
+
+template <typename T>
+size_t SparseVector<T>::getNonZeroCount() const
+{
+    return m_indices.getSize();
+}
+
+template <typename T>
+const Vector<size_t>& SparseVector<T>::indices() const
+{
+    return m_indices;
+}
+
+template <typename T>
+const Vector<T>& SparseVector<T>::values() const
+{
+    return m_values;
+}
+
+template <typename T>
+T SparseVector<T>::get(size_t index) const
+{
+    size_t slot = lower_slot(index);
+    if (slot < m_indices.getSize() && m_indices[slot] == index)
+    {
+        return m_values[slot];
+    }
+    return T();
+}
+
+template <typename T>
+T SparseVector<T>::at(size_t index) const
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+    return get(index);
+}
+
+template <typename T>
+void SparseVector<T>::set(size_t index, const T& value)
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range("Index out of range");
+    }
+
+    bool is_default = value == T();
+    size_t count = m_indices.getSize();
+    if (count == 0 || m_indices[count - 1] < index)
+    {
+        // Filling in order is the common case and needs no search.
+        if (!is_default)
+        {
+            m_indices.push_back(index);
+            m_values.push_back(value);
+        }
+        return;
+    }
+
+    size_t slot = lower_slot(index);
+    if (m_indices[slot] == index)
+    {
+        if (is_default)
+        {
+            m_indices.erase(slot);
+            m_values.erase(slot);
+        }
+        else
+        {
+            m_values[slot] = value;
+        }
+    }
+    else if (!is_default)
+    {
+        m_indices.insert(slot, index);
+        m_values.insert(slot, value);
+    }
+}
+
+template <typename T>
+void SparseVector<T>::resize(size_t new_size)
+{
+    size_t keep = lower_slot(new_size);
+    m_indices.resize(keep);
+    m_values.resize(keep);
+    m_size = new_size;
+}
+
+template <typename T>
+void SparseVector<T>::reserve(size_t count)
+{
+    m_indices.reserve(count);
+    m_values.reserve(count);
+}
+
+template <typename T>
+void SparseVector<T>::clear()
+{
+    m_indices.clear();
+    m_values.clear();
+}
+
+template <typename T>
+void SparseVector<T>::to_dense(Vector<T>& dense) const
+{
+    dense.assign(m_size, T());
+    T* out = dense.data();
+    for (size_t k = 0; k < m_indices.getSize(); ++k)
+    {
+        out[m_indices[k]] = m_values[k];
+    }
+}
+
+template <typename T>
+Vector<T> SparseVector<T>::to_dense() const
+{
+    Vector<T> dense;
+    to_dense(dense);
+    return dense;
+}
+
+/**
+ * @brief Dot product of a sparse and a dense vector.
+ *
+ * Only the stored elements contribute. For arithmetic types four partial sums are
+ * kept so consecutive products don't wait on each other.
+ *
+ * @throw std::invalid_argument If the sizes don't match.
+ */
+template<typename T>
+T dot(const SparseVector<T>& sparse, const Vector<T>& dense)
+{
+    if (sparse.getSize() != dense.getSize())
+    {
+        throw std::invalid_argument("Vector sizes don't match");
+    }
+
+    const size_t* indices = sparse.indices().data();
+    const T* values = sparse.values().data();
+    const T* x = dense.data();
+    size_t count = sparse.getNonZeroCount();
+    size_t k = 0;
+
+    T sum0 = T();
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        T sum1 = T();
+        T sum2 = T();
+        T sum3 = T();
+        for (; k + 4 <= count; k += 4)
+        {
+            sum0 += values[k] * x[indices[k]];
+            sum1 += values[k + 1] * x[indices[k + 1]];
+            sum2 += values[k + 2] * x[indices[k + 2]];
+            sum3 += values[k + 3] * x[indices[k + 3]];
+        }
+        sum0 = (sum0 + sum1) + (sum2 + sum3);
+    }
+    for (; k < count; ++k)
+    {
+        sum0 += values[k] * x[indices[k]];
+    }
+    return sum0;
+}
+
+/**
+ * @brief Adds a scaled sparse vector to a dense one: dense += alpha * sparse.
+ *
+ * Positions are unique, so the updates are independent and the compiler may turn
+ * the loop into vector gathers and scatters.
+ *
+ * @throw std::invalid_argument If the sizes don't match.
+ */
+template<typename T>
+void axpy(const T& alpha, const SparseVector<T>& sparse, Vector<T>& dense)
+{
+    if (sparse.getSize() != dense.getSize())
+    {
+        throw std::invalid_argument("Vector sizes don't match");
+    }
+
+    const size_t* indices = sparse.indices().data();
+    const T* values = sparse.values().data();
+    T* y = dense.data();
+    size_t count = sparse.getNonZeroCount();
+    for (size_t k = 0; k < count; ++k)
+    {
+        y[indices[k]] += alpha * values[k];
+    }
+}
@@ -0,0 +1,429 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include "Vector.hpp"
+
+/**
+ * @brief Settings of a StreamLoader.
+ */
+struct StreamLoaderOptions
+{
+    /**
+     * @brief Number of bytes read from the file at once.
+     */
+    size_t chunk_size = 4u << 20;
+
+    /**
+     * @brief Maximum number of bytes held in chunks that are read but not yet parsed.
+     *
+     * At least two chunks are always allowed, so reading and parsing can overlap.
+     */
+    size_t memory_budget = 64u << 20;
+
+    /**
+     * @brief Number of background threads reading the file.
+     */
+    size_t io_threads = 1;
+};
+
+/**
+ * @brief Reads files on background threads while the calling thread parses them.
+ *
+ * The file is split into fixed-size chunks. I/O threads read chunks ahead into a
+ * bounded set of buffers, and the calling thread hands every chunk to the parser
+ * stage in file order. When all buffers are full the readers wait until the
+ * parser releases one (backpressure), so memory use never exceeds the budget.
+ *
+ * A load can be stopped from another thread with cancel(), or from the parser by
+ * returning false from the chunk callback. Errors from the I/O threads are
+ * rethrown on the calling thread.
+ */
+class StreamLoader
+{
+private:
+    StreamLoaderOptions m_options;
+
+    /**
+     * @brief Set by cancel() and cleared when the load it applies to ends.
+     */
+    std::atomic<bool> m_cancelled;
+
+    /**
+     * @brief Whether the last load that ended was cancelled.
+     */
+    std::atomic<bool> m_last_cancelled;
+
+    /**
+     * @brief Guards the pipeline state of the current load and wakes up waiting threads.
+     */
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+
+    /**
+     * @brief Number of chunk buffers: what fits into the budget, but at least two and no more than needed.
+     */
+    size_t buffer_count(size_t chunk_size, size_t chunk_count) const
+    {
+        size_t count = m_options.memory_budget / chunk_size;
+        if (count < 2)
+        {
+            count = 2;
+        }
+        return count < chunk_count ? count : (chunk_count == 0 ? 1 : chunk_count);
+    }
+
+    static size_t file_size(const std::string& path)
+    {
+        std::error_code error;
+        auto size = std::filesystem::file_size(path, error);
+        if (error)
+        {
+            throw std::runtime_error("Can't open file: " + path);
+        }
+        return static_cast<size_t>(size);
+    }
+
+    template<typename Consumer>
+    bool run(const std::string& path, size_t chunk_size, Consumer&& consumer);
+
+    /**
+     * @brief Consumes the pending cancel request at the end of a load.
+     *
+     * @param completed Whether every chunk was processed.
+     * @return True if the load completed and wasn't cancelled.
+     */
+    bool end_load(bool completed)
+    {
+        bool cancelled = m_cancelled.exchange(false);
+        m_last_cancelled.store(cancelled);
+        return completed && !cancelled;
+    }
+
+public:
+    /**
+     * @brief Constructor: creates a loader with the given settings.
+     *
+     * @param options The loader settings.
+     * @throw std::invalid_argument If chunk_size or io_threads is zero.
+     */
+    explicit StreamLoader(StreamLoaderOptions options = StreamLoaderOptions());
+
+    /**
+     * @brief Requests the current load to stop. Safe to call from any thread.
+     *
+     * If no load is running, the next one stops before reading anything.
+     */
+    void cancel();
+
+    /**
+     * @brief Checks if the last load was cancelled or a cancel is pending.
+     */
+    bool cancelled() const;
+
+    /**
+     * @brief Passes every chunk of a file to a callback in file order.
+     *
+     * @param path The file to read.
+     * @param consumer Callable taking std::span<const char> and returning false to stop.
+     * @return True if the whole file was processed, false if the load was stopped.
+     * @throw std::runtime_error If the file can't be read.
+     */
+    template<typename Consumer>
+    bool for_each_chunk(const std::string& path, Consumer&& consumer);
+
+    /**
+     * @brief Passes every line of a file to a callback in file order.
+     *
+     * Lines are split on '\n'; a trailing '\r' is removed. The view is only valid during the call.
+     *
+     * @param path The file to read.
+     * @param consumer Callable taking std::string_view and returning false to stop.
+     * @return True if the whole file was processed, false if the load was stopped.
+     * @throw std::runtime_error If the file can't be read.
+     */
+    template<typename Consumer>
+    bool for_each_line(const std::string& path, Consumer&& consumer);
+
+    /**
+     * @brief Parses every line of a file and appends the results to a vector.
+     *
+     * @param path The file to read.
+     * @param parse Callable taking std::string_view and returning T.
+     * @param out The vector the results are appended to.
+     * @return True if the whole file was processed, false if the load was cancelled.
+     * @throw std::runtime_error If the file can't be read.
+     */
+    template<typename T, typename Parser>
+    bool load_lines(const std::string& path, Parser&& parse, Vector<T>& out);
+
+    /**
+     * @brief Appends the raw contents of a file, interpreted as an array of T, to a vector.
+     *
+     * @param path The file to read.
+     * @param out The vector the elements are appended to.
+     * @return True if the whole file was processed, false if the load was cancelled.
+     * @throw std::runtime_error If the file can't be read or its size is not a multiple of sizeof(T).
+     */
+    template<typename T>
+    bool load_binary(const std::string& path, Vector<T>& out);
+};
+
+inline StreamLoader::StreamLoader(StreamLoaderOptions options) : m_options(options), m_cancelled(false), m_last_cancelled(false)
+{
+    if (m_options.chunk_size == 0 || m_options.io_threads == 0)
+    {
+        throw std::invalid_argument("chunk_size and io_threads must be positive");
+    }
+}
+
+inline void StreamLoader::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cancelled.store(true);
+    }
+    m_changed.notify_all();
+}
+
+inline bool StreamLoader::cancelled() const
+{
+    return m_cancelled.load() || m_last_cancelled.load();
+}
+
+template <typename Consumer>
+bool StreamLoader::run(const std::string& path, size_t chunk_size, Consumer&& consumer)
+{
+    const size_t total = file_size(path);
+    const size_t chunk_count = (total + chunk_size - 1) / chunk_size;
+    const size_t slots = buffer_count(chunk_size, chunk_count);
+
+    Vector<Vector<char>> buffers;
+    Vector<size_t> lengths(slots);
+    Vector<bool> ready(slots);
+    for (size_t i = 0; i < slots; ++i)
+    {
+        buffers.push_back(Vector<char>());
+        lengths.push_back(0);
+        ready.push_back(false);
+    }
+
+    size_t next_chunk = 0;
+    size_t consumed = 0;
+    bool stop = false;
+    std::exception_ptr error;
+
+    auto reader = [&]() {
+        std::ifstream file(path, std::ios::binary);
+        while (true)
+        {
+            size_t chunk;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (stop || next_chunk >= chunk_count)
+                {
+                    return;
+                }
+                chunk = next_chunk++;
+                m_changed.wait(lock, [&] { return stop || m_cancelled.load() || chunk < consumed + slots; });
+                if (stop || m_cancelled.load())
+                {
+                    return;
+                }
+            }
+
+            size_t slot = chunk % slots;
+            size_t offset = chunk * chunk_size;
+            size_t length = (total - offset < chunk_size) ? total - offset : chunk_size;
+            try
+            {
+                Vector<char>& buffer = buffers[slot];
+                buffer.reserve(chunk_size);
+                file.seekg(static_cast<std::streamoff>(offset));
+                file.read(buffer.data(), static_cast<std::streamsize>(length));
+                if (!file)
+                {
+                    throw std::runtime_error("Can't read file: " + path);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+                stop = true;
+                m_changed.notify_all();
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            lengths[slot] = length;
+            ready[slot] = true;
+            m_changed.notify_all();
+        }
+    };
+
+    Vector<std::thread> threads;
+    size_t thread_count = m_options.io_threads < chunk_count ? m_options.io_threads : chunk_count;
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        threads.push_back(std::thread(reader));
+    }
+
+    auto shutdown = [&]() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            stop = true;
+        }
+        m_changed.notify_all();
+        for (auto &&thread : threads)
+        {
+            thread.join();
+        }
+    };
+
+    bool completed = true;
+    try
+    {
+        for (size_t chunk = 0; chunk < chunk_count; ++chunk)
+        {
+            size_t slot = chunk % slots;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_changed.wait(lock, [&] { return ready[slot] || error || m_cancelled.load(); });
+                if (error || (m_cancelled.load() && !ready[slot]))
+                {
+                    completed = false;
+                    break;
+                }
+            }
+
+            if (m_cancelled.load() || !consumer(std::span<const char>(buffers[slot].data(), lengths[slot])))
+            {
+                completed = false;
+                break;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                ready[slot] = false;
+                ++consumed;
+            }
+            m_changed.notify_all();
+        }
+    }
+    catch (...)
+    {
+        shutdown();
+        end_load(false);
+        throw;
+    }
+
+    shutdown();
+    completed = end_load(completed);
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    return completed;
+}
+
+template <typename Consumer>
+bool StreamLoader::for_each_chunk(const std::string& path, Consumer&& consumer)
+{
+    return run(path, m_options.chunk_size, consumer);
+}
+
+template <typename Consumer>
+bool StreamLoader::for_each_line(const std::string& path, Consumer&& consumer)
+{
+    std::string carry;
+
+    auto emit = [&](std::string_view line) {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.remove_suffix(1);
+        }
+        return static_cast<bool>(consumer(line));
+    };
+
+    bool completed = run(path, m_options.chunk_size, [&](std::span<const char> chunk) {
+        std::string_view text(chunk.data(), chunk.size());
+        size_t start = 0;
+        for (size_t newline = text.find('\n'); newline != std::string_view::npos; newline = text.find('\n', start))
+        {
+            bool keep_going;
+            if (carry.empty())
+            {
+                keep_going = emit(text.substr(start, newline - start));
+            }
+            else
+            {
+                carry.append(text.substr(start, newline - start));
+                keep_going = emit(carry);
+                carry.clear();
+            }
+            if (!keep_going)
+            {
+                return false;
+            }
+            start = newline + 1;
+        }
+        carry.append(text.substr(start));
+        return true;
+    });
+
+    if (completed && !carry.empty())
+    {
+        return emit(carry);
+    }
+    return completed;
+}
+
+template <typename T, typename Parser>
+bool StreamLoader::load_lines(const std::string& path, Parser&& parse, Vector<T>& out)
+{
+    return for_each_line(path, [&](std::string_view line) {
+        out.push_back(parse(line));
+        return true;
+    });
+}
+
+template <typename T>
+bool StreamLoader::load_binary(const std::string& path, Vector<T>& out)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "load_binary requires a trivially copyable type");
+
+    size_t total = file_size(path);
+    if (total % sizeof(T) != 0)
+    {
+        throw std::runtime_error("File size is not a multiple of the element size: " + path);
+    }
+    out.reserve(out.getSize() + total / sizeof(T));
+
+    // Chunks hold whole elements, so none of them is split between two chunks.
+    size_t chunk_size = m_options.chunk_size / sizeof(T) * sizeof(T);
+    if (chunk_size == 0)
+    {
+        chunk_size = sizeof(T);
+    }
+
+    return run(path, chunk_size, [&](std::span<const char> chunk) {
+        size_t old_size = out.getSize();
+        out.resize_for_overwrite(old_size + chunk.size() / sizeof(T));
+        std::memcpy(static_cast<void*>(out.data() + old_size), chunk.data(), chunk.size());
+        return true;
+    });
+}
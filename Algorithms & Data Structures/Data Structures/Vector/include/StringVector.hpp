@@ -0,0 +1,474 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include "HashIndex.hpp"
+#include "Vector.hpp"
+
+/**
+ * @brief Sequence of strings stored back to back in one character buffer.
+ *
+ * Vector<std::string> pays a full std::string per slot plus a heap allocation for
+ * every string that doesn't fit the small-string buffer, and growing it moves every
+ * string. Here all characters go into one Vector<char> and an offsets array marks
+ * where each string starts, so a string costs its characters plus one Offset, and
+ * growing copies two flat buffers.
+ *
+ * String i occupies characters [offsets[i], offsets[i + 1]). The offsets array always
+ * holds getSize() + 1 entries and starts with 0.
+ *
+ * Strings can optionally be deduplicated with intern(). The hash index behind it is
+ * built on the first call to intern() or find() and kept up to date afterwards.
+ *
+ * @tparam Offset Unsigned integer type of the offsets. uint32_t limits the total
+ *         number of characters to 4 GiB; use uint64_t for more.
+ */
+template<typename Offset = uint32_t>
+class StringVector
+{
+    static_assert(std::is_unsigned_v<Offset>, "Offset must be an unsigned integer type");
+
+public:
+    /**
+     * @brief Returned by find() when the string is not stored.
+     */
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+private:
+    /**
+     * @brief Characters of all strings, without separators.
+     */
+    Vector<char> m_chars;
+
+    /**
+     * @brief Start of each string in m_chars, plus the total number of characters at the end.
+     */
+    Vector<Offset> m_offsets;
+
+    /**
+     * @brief Index of string positions by content; maps each distinct string to its first position.
+     */
+    HashIndex m_index;
+
+    /**
+     * @brief Whether m_index covers all strings.
+     */
+    bool m_indexed;
+
+    static size_t hash(std::string_view str)
+    {
+        return std::hash<std::string_view>()(str);
+    }
+
+    /**
+     * @brief Makes room for count more characters, growing geometrically.
+     */
+    void grow_chars(size_t count);
+
+    /**
+     * @brief Appends characters as a new string without touching the index.
+     */
+    size_t append(std::string_view str);
+
+    /**
+     * @brief Adds a position to the index unless an equal string is already there.
+     */
+    void index_position(size_t position);
+
+    /**
+     * @brief Builds the index over all stored strings if it doesn't exist yet.
+     */
+    void build_index();
+
+public:
+    /**
+     * @brief Iterator over the strings as string_view values.
+     */
+    class ConstIterator
+    {
+    private:
+        const StringVector* m_owner;
+        size_t m_position;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        ConstIterator(const StringVector* owner, size_t position) : m_owner(owner), m_position(position) {}
+
+        std::string_view operator*() const
+        {
+            return (*m_owner)[m_position];
+        }
+
+        ConstIterator& operator++()
+        {
+            ++m_position;
+            return *this;
+        }
+
+        ConstIterator operator++(int)
+        {
+            ConstIterator tmp = *this;
+            ++m_position;
+            return tmp;
+        }
+
+        bool operator==(const ConstIterator& other) const
+        {
+            return m_position == other.m_position;
+        }
+
+        bool operator!=(const ConstIterator& other) const
+        {
+            return m_position != other.m_position;
+        }
+    };
+
+    /**
+     * @brief Default constructor: Initializes an empty vector.
+     */
+    StringVector();
+
+    /**
+     * @brief Constructor that copies the strings of a range.
+     *
+     * @param strings Any range of values convertible to std::string_view.
+     */
+    template<typename Range>
+    explicit StringVector(const Range& strings);
+
+    /**
+     * @brief Returns the number of strings.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Returns the total number of characters in all strings.
+     */
+    size_t getByteCount() const;
+
+    /**
+     * @brief Checks if there are no strings.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the length of a string without bounds checking.
+     *
+     * @param index The index of the string.
+     */
+    size_t length(size_t index) const;
+
+    /**
+     * @brief Access to a string by index without bounds checking.
+     *
+     * The view stays valid until the next operation that adds strings.
+     *
+     * @param index The index of the string.
+     * @return View of the characters of the string.
+     */
+    std::string_view operator[](size_t index) const;
+
+    /**
+     * @brief Access to a string by index with bounds checking.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    std::string_view at(size_t index) const;
+
+    /**
+     * @brief Returns the characters of all strings as one span.
+     */
+    std::span<const char> chars() const;
+
+    /**
+     * @brief Appends a string. Equal strings are stored again.
+     *
+     * @param str The characters to copy. They may refer to this vector's storage.
+     * @return The index of the new string.
+     * @throw std::length_error If the total number of characters would not fit in Offset.
+     */
+    size_t push_back(std::string_view str);
+
+    /**
+     * @brief Appends all strings of a range with one allocation for the characters.
+     *
+     * @param strings Any range of values convertible to std::string_view.
+     * @throw std::length_error If the total number of characters would not fit in Offset.
+     */
+    template<typename Range>
+    void append_range(const Range& strings);
+
+    /**
+     * @brief Returns the index of an equal string, appending the string if there is none.
+     *
+     * The first call builds a hash index over all stored strings.
+     *
+     * @param str The string to look up.
+     * @return The index of the first stored string equal to str.
+     * @throw std::length_error If the total number of characters would not fit in Offset.
+     */
+    size_t intern(std::string_view str);
+
+    /**
+     * @brief Returns the index of the first string equal to str, or npos.
+     *
+     * The first call builds a hash index over all stored strings.
+     *
+     * @param str The string to look up.
+     */
+    size_t find(std::string_view str);
+
+    /**
+     * @brief Removes the last string.
+     *
+     * @throw std::out_of_range If the vector is empty.
+     */
+    void pop_back();
+
+    /**
+     * @brief Pre-allocation of memory for strings and characters.
+     *
+     * @param string_capacity The number of strings to reserve space for.
+     * @param byte_capacity The total number of characters to reserve space for.
+     */
+    void reserve(size_t string_capacity, size_t byte_capacity);
+
+    /**
+     * @brief Removes all strings but doesn't free the memory.
+     */
+    void clear();
+
+    ConstIterator begin() const { return ConstIterator(this, 0); }
+    ConstIterator end() const { return ConstIterator(this, getSize()); }
+};
+
+template <typename Offset>
+StringVector<Offset>::StringVector() : m_indexed(false)
+{
+    m_offsets.push_back(0);
+}
+
+template <typename Offset>
+template <typename Range>
+StringVector<Offset>::StringVector(const Range& strings) : StringVector()
+{
+    append_range(strings);
+}
+
+template <typename Offset>
+size_t StringVector<Offset>::getSize() const
+{
+    return m_offsets.getSize() - 1;
+}
+
+template <typename Offset>
+size_t StringVector<Offset>::getByteCount() const
+{
+    return m_chars.getSize();
+}
+
+template <typename Offset>
+bool StringVector<Offset>::empty() const
+{
+    return getSize() == 0;
+}
+
+template <typename Offset>
+size_t StringVector<Offset>::length(size_t index) const
+{
+    return static_cast<size_t>(m_offsets[index + 1] - m_offsets[index]);
+}
+
+template <typename Offset>
+std::string_view StringVector<Offset>::operator[](size_t index) const
+{
+    return std::string_view(m_chars.data() + m_offsets[index], length(index));
+}
+
+template <typename Offset>
+std::string_view StringVector<Offset>::at(size_t index) const
+{
+    if (index >= getSize())
+    {
+        throw std::out_of_range("Index out of range");
+    }
+    return (*this)[index];
+}
+
+template <typename Offset>
+std::span<const char> StringVector<Offset>::chars() const
+{
+    return std::span<const char>(m_chars.data(), m_chars.getSize());
+}
+
+template <typename Offset>
+void StringVector<Offset>::grow_chars(size_t count)
+{
+    size_t needed = m_chars.getSize() + count;
+    if (needed > static_cast<size_t>(std::numeric_limits<Offset>::max()))
+    {
+        throw std::length_error("StringVector exceeds the range of its offset type");
+    }
+    if (needed > m_chars.getCapacity())
+    {
+        size_t new_capacity = m_chars.getCapacity() == 0 ? 64 : m_chars.getCapacity();
+        while (new_capacity < needed)
+        {
+            new_capacity *= 2;
+        }
+        m_chars.reserve(new_capacity);
+    }
+}
+
+template <typename Offset>
+size_t StringVector<Offset>::append(std::string_view str)
+{
+    // The string may be a view of our own characters, e.g. push_back((*this)[0]);
+    // growing would free it, so remember its offset and find it again afterwards.
+    const char* first = m_chars.data();
+    bool aliased = !str.empty() && first != nullptr && std::less_equal<const char*>()(first, str.data())
+        && std::less<const char*>()(str.data(), first + m_chars.getSize());
+    size_t source_offset = aliased ? static_cast<size_t>(str.data() - first) : 0;
+
+    grow_chars(str.size());
+    size_t start = m_chars.getSize();
+    m_chars.resize(start + str.size());
+    if (!str.empty())
+    {
+        const char* source = aliased ? m_chars.data() + source_offset : str.data();
+        std::memcpy(m_chars.data() + start, source, str.size());
+    }
+    m_offsets.push_back(static_cast<Offset>(m_chars.getSize()));
+    return getSize() - 1;
+}
+
+template <typename Offset>
+void StringVector<Offset>::index_position(size_t position)
+{
+    std::string_view str = (*this)[position];
+    size_t str_hash = hash(str);
+    auto equal = [this, str](size_t stored) { return (*this)[stored] == str; };
+    if (m_index.find(str_hash, equal) == HashIndex::npos)
+    {
+        m_index.insert(str_hash, position, [this](size_t stored) { return hash((*this)[stored]); });
+    }
+}
+
+template <typename Offset>
+void StringVector<Offset>::build_index()
+{
+    if (m_indexed)
+    {
+        return;
+    }
+    m_index.reserve(getSize(), [this](size_t stored) { return hash((*this)[stored]); });
+    for (size_t i = 0; i < getSize(); ++i)
+    {
+        index_position(i);
+    }
+    m_indexed = true;
+}
+
+template <typename Offset>
+size_t StringVector<Offset>::push_back(std::string_view str)
+{
+    size_t position = append(str);
+    if (m_indexed)
+    {
+        index_position(position);
+    }
+    return position;
+}
+
+template <typename Offset>
+template <typename Range>
+void StringVector<Offset>::append_range(const Range& strings)
+{
+    // First pass: size everything so both buffers are allocated once.
+    size_t count = 0;
+    size_t bytes = 0;
+    for (auto &&str : strings)
+    {
+        bytes += std::string_view(str).size();
+        ++count;
+    }
+    grow_chars(bytes);
+    m_offsets.reserve(m_offsets.getSize() + count);
+
+    for (auto &&str : strings)
+    {
+        push_back(std::string_view(str));
+    }
+}
+
+template <typename Offset>
+size_t StringVector<Offset>::intern(std::string_view str)
+{
+    size_t position = find(str);
+    if (position != npos)
+    {
+        return position;
+    }
+    // Hash before appending: str may view this vector's characters, which append() can reallocate.
+    size_t str_hash = hash(str);
+    position = append(str);
+    m_index.insert(str_hash, position, [this](size_t stored) { return hash((*this)[stored]); });
+    return position;
+}
+
+template <typename Offset>
+size_t StringVector<Offset>::find(std::string_view str)
+{
+    build_index();
+    size_t slot = m_index.find(hash(str), [this, str](size_t stored) { return (*this)[stored] == str; });
+    return slot == HashIndex::npos ? npos : m_index.value(slot);
+}
+
+template <typename Offset>
+void StringVector<Offset>::pop_back()
+{
+    if (empty())
+    {
+        throw std::out_of_range("Can't pop_back from an empty StringVector");
+    }
+
+    size_t position = getSize() - 1;
+    if (m_indexed)
+    {
+        std::string_view str = (*this)[position];
+        size_t slot = m_index.find(hash(str), [this, str](size_t stored) { return (*this)[stored] == str; });
+        if (slot != HashIndex::npos && m_index.value(slot) == position)
+        {
+            m_index.erase_slot(slot);
+        }
+    }
+    m_offsets.pop_back();
+    m_chars.resize(static_cast<size_t>(m_offsets[position]));
+}
+
+template <typename Offset>
+void StringVector<Offset>::reserve(size_t string_capacity, size_t byte_capacity)
+{
+    m_offsets.reserve(string_capacity + 1);
+    m_chars.reserve(byte_capacity);
+}
+
+template <typename Offset>
+void StringVector<Offset>::clear()
+{
+    m_chars.clear();
+    m_offsets.clear();
+    m_offsets.push_back(0);
+    m_index.clear();
+}
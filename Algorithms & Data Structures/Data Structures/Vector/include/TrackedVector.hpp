@@ -0,0 +1,561 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Vector.hpp"
+
+/**
+ * @brief Element range [begin, end) reported by TrackedVector::dirty_ranges().
+ */
+struct DirtyRange
+{
+    size_t begin;
+    size_t end;
+};
+
+/**
+ * @brief Vector that remembers which blocks of elements changed since the last checkpoint.
+ *
+ * The elements are split into fixed-size blocks (4 KiB by default) and one bit per block
+ * records whether anything in it was written. Every modification goes through this
+ * class: writes via operator[] return a proxy that marks the block on assignment, and
+ * push_back, insert, erase and resize mark the blocks they touch.
+ *
+ * A checkpoint then only needs the dirty blocks: write_changes() emits them together
+ * with the current size, and apply_changes() replays them onto a replica.
+ *
+ * @tparam T The type of elements stored in the vector.
+ */
+template<typename T>
+class TrackedVector
+{
+private:
+    Vector<T> m_values;
+
+    /**
+     * @brief One bit per block, set if the block changed.
+     */
+    Vector<uint64_t> m_dirty;
+
+    /**
+     * @brief Number of elements per block.
+     */
+    size_t m_block_size;
+
+    /**
+     * @brief Whether the size changed since the last clear_dirty(), even if no block did.
+     */
+    bool m_resized;
+
+    void ensure_bitmap(size_t element_count);
+
+public:
+    /**
+     * @brief Write handle returned by the non-const operator[].
+     */
+    class Reference
+    {
+    private:
+        TrackedVector* m_owner;
+        size_t m_index;
+
+    public:
+        Reference(TrackedVector* owner, size_t index) : m_owner(owner), m_index(index) {}
+
+        operator const T&() const { return m_owner->m_values[m_index]; }
+
+        Reference& operator=(const T& value)
+        {
+            m_owner->modify(m_index) = value;
+            return *this;
+        }
+
+        Reference& operator=(T&& value)
+        {
+            m_owner->modify(m_index) = std::move(value);
+            return *this;
+        }
+
+        Reference& operator=(const Reference& other)
+        {
+            return *this = static_cast<const T&>(other);
+        }
+
+        template<typename U>
+        Reference& operator+=(const U& value)
+        {
+            m_owner->modify(m_index) += value;
+            return *this;
+        }
+
+        template<typename U>
+        Reference& operator-=(const U& value)
+        {
+            m_owner->modify(m_index) -= value;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief Constructor: Initializes an empty vector.
+     *
+     * @param block_bytes Size of a tracked block in bytes; rounded down to whole elements, at least one.
+     */
+    explicit TrackedVector(size_t block_bytes = 4096);
+
+    /**
+     * @brief Constructor that takes over an existing vector. All its elements start out clean.
+     *
+     * @param values The vector to track.
+     * @param block_bytes Size of a tracked block in bytes.
+     */
+    explicit TrackedVector(Vector<T> values, size_t block_bytes = 4096);
+
+    size_t getSize() const;
+    size_t getCapacity() const;
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of elements per tracked block.
+     */
+    size_t getBlockSize() const;
+
+    /**
+     * @brief Read access to an element without bounds checking.
+     */
+    const T& operator[](size_t index) const;
+
+    /**
+     * @brief Write access to an element without bounds checking; assignments mark its block dirty.
+     */
+    Reference operator[](size_t index);
+
+    /**
+     * @brief Read access to an element with bounds checking.
+     *
+     * @throw std::out_of_range If the index is out of range.
+     */
+    const T& at(size_t index) const;
+
+    /**
+     * @brief Marks the block of an element dirty and returns the element for in-place changes.
+     *
+     * @param index The position of the element.
+     * @throw std::out_of_range If the index is out of range.
+     */
+    T& modify(size_t index);
+
+    /**
+     * @brief Marks the blocks of elements [begin, end) dirty, e.g. after writing through data().
+     */
+    void mark_dirty(size_t begin, size_t end);
+
+    /**
+     * @brief Read-only view of the underlying vector.
+     */
+    const Vector<T>& values() const;
+
+    void push_back(const T& value);
+    void push_back(T&& value);
+    void pop_back();
+    void insert(size_t index, const T& value);
+    void erase(size_t index);
+    void resize(size_t new_size, const T& value = T());
+    void reserve(size_t new_capacity);
+    void clear();
+
+    /**
+     * @brief Returns the changed element ranges, with neighbouring dirty blocks merged.
+     *
+     * Ranges are clipped to the current size.
+     */
+    Vector<DirtyRange> dirty_ranges() const;
+
+    /**
+     * @brief Checks if anything changed since the last clear_dirty(), including the size.
+     */
+    bool is_dirty() const;
+
+    /**
+     * @brief Marks everything as clean.
+     */
+    void clear_dirty();
+
+    /**
+     * @brief Writes the changes since the last checkpoint and marks everything as clean.
+     *
+     * Format: a header (magic, element size, current size, range count), then for every
+     * dirty range its begin, element count and the raw element bytes. All header fields
+     * are 64-bit in host byte order.
+     *
+     * @param out The stream to write to.
+     * @return The number of elements written.
+     * @throw std::runtime_error If writing fails. The dirty state is kept in that case.
+     */
+    size_t write_changes(std::ostream& out);
+
+    /**
+     * @brief Writes all elements in the format of write_changes() and marks everything as clean.
+     *
+     * @param out The stream to write to.
+     * @throw std::runtime_error If writing fails.
+     */
+    void write_full(std::ostream& out);
+
+    typename Vector<T>::ConstIterator begin() const { return m_values.begin(); }
+    typename Vector<T>::ConstIterator end() const { return m_values.end(); }
+};
+
+namespace tracked_detail
+{
+    /**
+     * @brief First field of every snapshot: "TRACK01" followed by a zero byte on little-endian machines.
+     */
+    constexpr uint64_t kSnapshotMagic = 0x0031304B43415254ull;
+
+    inline unsigned lowest_bit(uint64_t mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(mask));
+#else
+        unsigned bit = 0;
+        while ((mask & 1u) == 0)
+        {
+            mask >>= 1;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    inline void write_u64(std::ostream& out, uint64_t value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    inline uint64_t read_u64(std::istream& in)
+    {
+        uint64_t value = 0;
+        if (!in.read(reinterpret_cast<char*>(&value), sizeof(value)))
+        {
+            throw std::runtime_error("Truncated TrackedVector snapshot");
+        }
+        return value;
+    }
+
+    template<typename T>
+    void write_snapshot(std::ostream& out, const Vector<T>& values, const Vector<DirtyRange>& ranges)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "snapshots require a trivially copyable type");
+
+        write_u64(out, kSnapshotMagic);
+        write_u64(out, sizeof(T));
+        write_u64(out, values.getSize());
+        write_u64(out, ranges.getSize());
+        for (size_t i = 0; i < ranges.getSize(); ++i)
+        {
+            size_t count = ranges[i].end - ranges[i].begin;
+            write_u64(out, ranges[i].begin);
+            write_u64(out, count);
+            out.write(reinterpret_cast<const char*>(values.data() + ranges[i].begin),
+                      static_cast<std::streamsize>(count * sizeof(T)));
+        }
+        if (!out)
+        {
+            throw std::runtime_error("Failed to write TrackedVector snapshot");
+        }
+    }
+}
+
+template <typename T>
+TrackedVector<T>::TrackedVector(size_t block_bytes)
+    : m_block_size(block_bytes / sizeof(T) == 0 ? 1 : block_bytes / sizeof(T)), m_resized(false)
+{
+    // Initialize an empty vector with no dirty blocks.
+}
+
+template <typename T>
+TrackedVector<T>::TrackedVector(Vector<T> values, size_t block_bytes)
+    : m_values(std::move(values)), m_block_size(block_bytes / sizeof(T) == 0 ? 1 : block_bytes / sizeof(T)),
+      m_resized(false)
+{
+    ensure_bitmap(m_values.getSize());
+}
+
+template <typename T>
+void TrackedVector<T>::ensure_bitmap(size_t element_count)
+{
+    size_t blocks = (element_count + m_block_size - 1) / m_block_size;
+    size_t words = (blocks + 63) / 64;
+    if (words > m_dirty.getSize())
+    {
+        m_dirty.resize(words, 0);
+    }
+}
+
+template <typename T>
+size_t TrackedVector<T>::getSize() const
+{
+    return m_values.getSize();
+}
+
+template <typename T>
+size_t TrackedVector<T>::getCapacity() const
+{
+    return m_values.getCapacity();
+}
+
+template <typename T>
+bool TrackedVector<T>::empty() const
+{
+    return m_values.empty();
+}
+
+template <typename T>
+size_t TrackedVector<T>::getBlockSize() const
+{
+    return m_block_size;
+}
+
+template <typename T>
+const T& TrackedVector<T>::operator[](size_t index) const
+{
+    return m_values[index];
+}
+
+template <typename T>
+typename TrackedVector<T>::Reference TrackedVector<T>::operator[](size_t index)
+{
+    return Reference(this, index);
+}
+
+template <typename T>
+const T& TrackedVector<T>::at(size_t index) const
+{
+    return m_values.at(index);
+}
+
+template <typename T>
+T& TrackedVector<T>::modify(size_t index)
+{
+    T& element = m_values.at(index);
+    size_t block = index / m_block_size;
+    m_dirty[block / 64] |= uint64_t(1) << (block % 64);
+    return element;
+}
+
+template <typename T>
+void TrackedVector<T>::mark_dirty(size_t begin, size_t end)
+{
+    if (end > m_values.getSize())
+    {
+        end = m_values.getSize();
+    }
+    if (begin >= end)
+    {
+        return;
+    }
+    ensure_bitmap(end);
+    for (size_t block = begin / m_block_size; block <= (end - 1) / m_block_size; ++block)
+    {
+        m_dirty[block / 64] |= uint64_t(1) << (block % 64);
+    }
+}
+
+template <typename T>
+const Vector<T>& TrackedVector<T>::values() const
+{
+    return m_values;
+}
+
+template <typename T>
+void TrackedVector<T>::push_back(const T& value)
+{
+    m_values.push_back(value);
+    m_resized = true;
+    mark_dirty(m_values.getSize() - 1, m_values.getSize());
+}
+
+template <typename T>
+void TrackedVector<T>::push_back(T&& value)
+{
+    m_values.push_back(std::move(value));
+    m_resized = true;
+    mark_dirty(m_values.getSize() - 1, m_values.getSize());
+}
+
+template <typename T>
+void TrackedVector<T>::pop_back()
+{
+    m_values.pop_back();
+    m_resized = true;
+}
+
+template <typename T>
+void TrackedVector<T>::insert(size_t index, const T& value)
+{
+    m_values.insert(index, value);
+    m_resized = true;
+    // Everything from the insertion point on moved one position.
+    mark_dirty(index, m_values.getSize());
+}
+
+template <typename T>
+void TrackedVector<T>::erase(size_t index)
+{
+    m_values.erase(index);
+    m_resized = true;
+    mark_dirty(index, m_values.getSize());
+}
+
+template <typename T>
+void TrackedVector<T>::resize(size_t new_size, const T& value)
+{
+    size_t old_size = m_values.getSize();
+    m_values.resize(new_size, value);
+    if (new_size != old_size)
+    {
+        m_resized = true;
+        mark_dirty(old_size, new_size);
+    }
+}
+
+template <typename T>
+void TrackedVector<T>::reserve(size_t new_capacity)
+{
+    m_values.reserve(new_capacity);
+}
+
+template <typename T>
+void TrackedVector<T>::clear()
+{
+    if (!m_values.empty())
+    {
+        m_resized = true;
+    }
+    m_values.clear();
+}
+
+template <typename T>
+Vector<DirtyRange> TrackedVector<T>::dirty_ranges() const
+{
+    Vector<DirtyRange> ranges;
+    size_t size = m_values.getSize();
+    size_t block_count = (size + m_block_size - 1) / m_block_size;
+
+    for (size_t word = 0; word * 64 < block_count; ++word)
+    {
+        uint64_t bits = m_dirty[word];
+        while (bits != 0)
+        {
+            size_t block = word * 64 + tracked_detail::lowest_bit(bits);
+            bits &= bits - 1;
+            if (block >= block_count)
+            {
+                break;
+            }
+
+            size_t begin = block * m_block_size;
+            size_t end = begin + m_block_size < size ? begin + m_block_size : size;
+            if (!ranges.empty() && ranges[ranges.getSize() - 1].end == begin)
+            {
+                ranges[ranges.getSize() - 1].end = end;
+            }
+            else
+            {
+                ranges.push_back(DirtyRange{begin, end});
+            }
+        }
+    }
+    return ranges;
+}
+
+template <typename T>
+bool TrackedVector<T>::is_dirty() const
+{
+    return m_resized || !dirty_ranges().empty();
+}
+
+template <typename T>
+void TrackedVector<T>::clear_dirty()
+{
+    for (size_t i = 0; i < m_dirty.getSize(); ++i)
+    {
+        m_dirty[i] = 0;
+    }
+    m_resized = false;
+}
+
+template <typename T>
+size_t TrackedVector<T>::write_changes(std::ostream& out)
+{
+    Vector<DirtyRange> ranges = dirty_ranges();
+    tracked_detail::write_snapshot(out, m_values, ranges);
+    clear_dirty();
+
+    size_t written = 0;
+    for (size_t i = 0; i < ranges.getSize(); ++i)
+    {
+        written += ranges[i].end - ranges[i].begin;
+    }
+    return written;
+}
+
+template <typename T>
+void TrackedVector<T>::write_full(std::ostream& out)
+{
+    Vector<DirtyRange> ranges;
+    if (!m_values.empty())
+    {
+        ranges.push_back(DirtyRange{0, m_values.getSize()});
+    }
+    tracked_detail::write_snapshot(out, m_values, ranges);
+    clear_dirty();
+}
+
+/**
+ * @brief Replays a snapshot written by TrackedVector::write_changes() or write_full().
+ *
+ * The replica is resized to the size recorded in the snapshot and the recorded
+ * ranges are overwritten; everything else is left as it was.
+ *
+ * @param in The stream to read from.
+ * @param replica The vector to update.
+ * @throw std::runtime_error If the stream is not a snapshot of T elements, is truncated,
+ *        or refers to elements outside the recorded size.
+ */
+template<typename T>
+void apply_changes(std::istream& in, Vector<T>& replica)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "snapshots require a trivially copyable type");
+    using tracked_detail::read_u64;
+
+    if (read_u64(in) != tracked_detail::kSnapshotMagic)
+    {
+        throw std::runtime_error("Not a TrackedVector snapshot");
+    }
+    if (read_u64(in) != sizeof(T))
+    {
+        throw std::runtime_error("TrackedVector snapshot has a different element size");
+    }
+
+    size_t size = static_cast<size_t>(read_u64(in));
+    size_t range_count = static_cast<size_t>(read_u64(in));
+    replica.resize(size);
+    for (size_t i = 0; i < range_count; ++i)
+    {
+        size_t begin = static_cast<size_t>(read_u64(in));
+        size_t count = static_cast<size_t>(read_u64(in));
+        if (begin > size || count > size - begin)
+        {
+            throw std::runtime_error("TrackedVector snapshot range out of bounds");
+        }
+        if (!in.read(reinterpret_cast<char*>(replica.data() + begin), static_cast<std::streamsize>(count * sizeof(T))))
+        {
+            throw std::runtime_error("Truncated TrackedVector snapshot");
+        }
+    }
+}
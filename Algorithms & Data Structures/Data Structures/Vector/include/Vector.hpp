@@ -1,5 +1,12 @@
 #pragma once
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <type_traits>
+#include <utility>
+
+template<typename E>
+class VectorExpression;
 
 /**
  * @brief Dynamic array implementation similar to std::vector.
@@ -29,6 +36,14 @@ private:
      */
     size_t m_capacity;
 
+    /**
+     * @brief Resets the elements in [from, to) to T() so that they release their resources.
+     *
+     * Slots past the size stay constructed, so without this a surplus std::string or
+     * Vector would keep its memory until the slot is overwritten.
+     */
+    void release_slots(size_t from, size_t to);
+
 public:
     /**
      * @brief Default constructor: Initializes an empty vector.
@@ -45,6 +60,8 @@ public:
     /**
      * @brief Copy constructor: Creates a copy of another vector.
      *
+     * Only the elements are copied: the capacity of the copy equals the size of other.
+     *
      * @param other The vector to copy from.
      */
     Vector(const Vector& other);
@@ -66,6 +83,9 @@ public:
     /**
      * @brief Copy assignment operator: copies data from another vector.
      *
+     * If the current capacity is enough, the existing memory is reused; otherwise
+     * exactly other.getSize() elements are allocated.
+     *
      * @param other The vector to copy from.
      * @return Reference to the current vector.
      */
@@ -79,6 +99,23 @@ public:
      */
     Vector& operator=(Vector&& other) noexcept;
 
+    /**
+     * @brief Constructor that evaluates an element-wise expression (see VectorExpr.hpp).
+     *
+     * @param expr The expression to evaluate.
+     */
+    template<typename E>
+    Vector(const VectorExpression<E>& expr);
+
+    /**
+     * @brief Assignment operator that evaluates an element-wise expression in one pass (see VectorExpr.hpp).
+     *
+     * @param expr The expression to evaluate. It may refer to this vector.
+     * @return Reference to the current vector.
+     */
+    template<typename E>
+    Vector& operator=(const VectorExpression<E>& expr);
+
     /**
      * @brief Index access operator: Allows access to elements by index.
      *
@@ -95,6 +132,20 @@ public:
      */
     const T& operator[](size_t index) const;
 
+    /**
+     * @brief Direct access to the underlying array.
+     *
+     * @return Pointer to the first element, or nullptr if no memory is allocated.
+     */
+    T* data();
+
+    /**
+     * @brief Const version data().
+     *
+     * @return Const pointer to the first element, or nullptr if no memory is allocated.
+     */
+    const T* data() const;
+
     /**
      * @brief Returns the current size of the vector.
      *
@@ -170,16 +221,54 @@ public:
      */
     void resize(size_t new_size, const T& value = T());
 
+    /**
+     * @brief Changes the number of elements without assigning the new ones.
+     *
+     * New elements keep whatever the slot held: an indeterminate value for trivial
+     * types, T() or an earlier element otherwise. Meant for buffers that are about to
+     * be overwritten, where resize() would write every element twice.
+     *
+     * @param new_size The new size of the vector.
+     */
+    void resize_for_overwrite(size_t new_size);
+
     /**
      * @brief Decreasing the capacity of a vector to its current size.
      */
     void shrink_to_fit();
 
+    /**
+     * @brief Decreasing the capacity of a vector to the specified value, but not below its size.
+     *
+     * Does nothing if the capacity is already less than or equal to the requested one.
+     * A vector without elements that is shrunk to zero releases its memory.
+     *
+     * @param new_capacity The requested capacity.
+     */
+    void shrink_to(size_t new_capacity);
+
     /**
      * @brief Clears the vector but does't free the memory.
      */
     void clear();
 
+    /**
+     * @brief Replaces the contents with count copies of a value.
+     *
+     * If the current capacity is enough, the existing memory is reused.
+     *
+     * @param count The new size of the vector.
+     * @param value The value to fill the vector with.
+     */
+    void assign(size_t count, const T& value);
+
+    /**
+     * @brief Exchanges the contents of two vectors without copying elements.
+     *
+     * @param other The vector to swap with.
+     */
+    void swap(Vector& other) noexcept;
+
     /**
      * @brief Inserts an element at the specified position.
      *
@@ -189,6 +278,22 @@ public:
      */
     void insert(size_t index, const T& value);
 
+    /**
+     * @brief Inserts several elements at once.
+     *
+     * Positions refer to the vector before the call: an element with position i is
+     * placed before the element that was at index i, or at the end if i equals the
+     * size. Elements with the same position keep their order from the batch. The
+     * positions don't have to be sorted.
+     *
+     * The memory grows at most once, and every existing element moves at most once,
+     * so the cost is O(n + k log k) instead of O(n * k) for k single inserts.
+     *
+     * @param batch Pairs of (position, value).
+     * @throw std::out_of_range If a position is greater than the size. Nothing is inserted then.
+     */
+    void insert_batch(Vector<std::pair<size_t, T>> batch);
+
     /**
      * @brief Removes an element from the specified position.
      *
@@ -502,7 +607,7 @@ Vector<T>::Vector(size_t initialCapacity)
 
 template <typename T>
 Vector<T>::Vector(const Vector &other)
-    : m_data(new T[other.m_capacity]), m_capacity(other.m_capacity), m_size(other.m_size)
+    : m_data(other.m_size == 0 ? nullptr : new T[other.m_size]), m_size(other.m_size), m_capacity(other.m_size)
 {
     // Copy elements from the other vector.
     for (size_t i = 0; i < m_size; ++i)
@@ -540,16 +645,27 @@ Vector<T>& Vector<T>::operator=(const Vector &other)
 {
     if (this != &other)
     {
-        delete[] m_data;
-
-        m_data = new T [other.m_capacity];
-        m_capacity = other.m_capacity;
-        m_size = other.m_size;
-
-        for (size_t i = 0; i < m_size; ++i)
+        if (other.m_size > m_capacity)
+        {
+            // Not enough room: copy into a new buffer before releasing the old one.
+            T* new_data = new T[other.m_size];
+            for (size_t i = 0; i < other.m_size; ++i)
+            {
+                new_data[i] = other.m_data[i];
+            }
+            delete[] m_data;
+            m_data = new_data;
+            m_capacity = other.m_size;
+        }
+        else
         {
-            m_data[i] = other.m_data[i];
+            for (size_t i = 0; i < other.m_size; ++i)
+            {
+                m_data[i] = other.m_data[i];
+            }
+            release_slots(other.m_size, m_size);
         }
+        m_size = other.m_size;
     }
     return *this;
 
@@ -588,6 +704,18 @@ const T& Vector<T>::operator[](size_t index) const
     return m_data[index];
 }
 
+template <typename T>
+T* Vector<T>::data()
+{
+    return m_data;
+}
+
+template <typename T>
+const T* Vector<T>::data() const
+{
+    return m_data;
+}
+
 template <typename T>
 size_t Vector<T>::getSize() const
 {
@@ -719,22 +847,50 @@ void Vector<T>::resize(size_t new_size, const T& value)
     m_size = new_size; 
 }
 
+template <typename T>
+void Vector<T>::resize_for_overwrite(size_t new_size)
+{
+    if (new_size > m_capacity)
+    {
+        reserve(new_size);
+    }
+    m_size = new_size;
+}
+
 template <typename T>
 void Vector<T>::shrink_to_fit()
 {
-    if (m_capacity == m_size)
+    shrink_to(m_size);
+}
+
+template <typename T>
+void Vector<T>::shrink_to(size_t new_capacity)
+{
+    if (new_capacity < m_size)
+    {
+        new_capacity = m_size;
+    }
+    if (new_capacity >= m_capacity)
     {
         return;
     }
 
-    T* new_data = new T[m_size];
+    if (new_capacity == 0)
+    {
+        delete[] m_data;
+        m_data = nullptr;
+        m_capacity = 0;
+        return;
+    }
+
+    T* new_data = new T[new_capacity];
     for (size_t i = 0; i < m_size; ++i)
     {
         new_data[i] = std::move(m_data[i]);
     }
     delete[] m_data;
     m_data = new_data;
-    m_capacity = m_size; 
+    m_capacity = new_capacity; 
 }
 
 template <typename T>
@@ -743,6 +899,51 @@ void Vector<T>::clear()
     m_size = 0;
 }
 
+template <typename T>
+void Vector<T>::release_slots(size_t from, size_t to)
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (size_t i = from; i < to; ++i)
+        {
+            m_data[i] = T();
+        }
+    }
+}
+
+template <typename T>
+void Vector<T>::assign(size_t count, const T& value)
+{
+    if (count > m_capacity)
+    {
+        T* new_data = new T[count];
+        for (size_t i = 0; i < count; ++i)
+        {
+            new_data[i] = value;
+        }
+        delete[] m_data;
+        m_data = new_data;
+        m_capacity = count;
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            m_data[i] = value;
+        }
+        release_slots(count, m_size);
+    }
+    m_size = count;
+}
+
+template <typename T>
+void Vector<T>::swap(Vector &other) noexcept
+{
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+    std::swap(m_capacity, other.m_capacity);
+}
+
 template <typename T>
 void Vector<T>::insert(size_t index, const T &value)
 {
@@ -776,6 +977,85 @@ void Vector<T>::insert(size_t index, const T &value)
     
 }
 
+template <typename T>
+void Vector<T>::insert_batch(Vector<std::pair<size_t, T>> batch)
+{
+    size_t count = batch.getSize();
+    if (count == 0)
+    {
+        return;
+    }
+
+    std::pair<size_t, T>* entries = batch.data();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (entries[i].first > m_size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    auto by_position = [](const std::pair<size_t, T>& a, const std::pair<size_t, T>& b) { return a.first < b.first; };
+    if (!std::is_sorted(entries, entries + count, by_position))
+    {
+        std::stable_sort(entries, entries + count, by_position);
+    }
+
+    size_t new_size = m_size + count;
+    if (new_size > m_capacity)
+    {
+        // Merge front to back into the new buffer.
+        size_t new_capacity = std::max(new_size, m_capacity * 2);
+        T* new_data = new T[new_capacity];
+        size_t read = 0;
+        size_t write = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (; read < entries[i].first; ++read)
+            {
+                new_data[write++] = std::move(m_data[read]);
+            }
+            new_data[write++] = std::move(entries[i].second);
+        }
+        for (; read < m_size; ++read)
+        {
+            new_data[write++] = std::move(m_data[read]);
+        }
+        delete[] m_data;
+        m_data = new_data;
+        m_capacity = new_capacity;
+    }
+    else
+    {
+        // Fill from the back: every run between two positions moves once, straight to its final place.
+        size_t read = m_size;
+        size_t write = new_size;
+        for (size_t i = count; i-- > 0;)
+        {
+            size_t position = entries[i].first;
+            size_t run = read - position;
+            if (run != 0)
+            {
+                if constexpr (std::is_trivially_copyable_v<T>)
+                {
+                    std::memmove(static_cast<void*>(m_data + write - run), m_data + position, run * sizeof(T));
+                }
+                else
+                {
+                    for (size_t j = 0; j < run; ++j)
+                    {
+                        m_data[write - 1 - j] = std::move(m_data[read - 1 - j]);
+                    }
+                }
+                write -= run;
+                read = position;
+            }
+            m_data[--write] = std::move(entries[i].second);
+        }
+    }
+    m_size = new_size;
+}
+
 template <typename T>
 void Vector<T>::erase(size_t index)
 {
@@ -797,3 +1077,15 @@ Vector<T>::~Vector()
 {
     delete[] m_data;
 }
+
+/**
+ * @brief Exchanges the contents of two vectors without copying elements.
+ *
+ * @param first The first vector.
+ * @param second The second vector.
+ */
+template <typename T>
+void swap(Vector<T>& first, Vector<T>& second) noexcept
+{
+    first.swap(second);
+}
@@ -0,0 +1,421 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Parallel.hpp"
+#include "Vector.hpp"
+
+/**
+ * @file VectorExpr.hpp
+ * @brief Lazy element-wise arithmetic on numeric vectors.
+ *
+ * Arithmetic operators, comparisons and the functions below don't compute anything
+ * when applied to a Vector of arithmetic type: they build a small expression object
+ * that remembers the operands. Assigning the expression to a Vector evaluates it in
+ * a single loop, element by element, without temporary vectors:
+ *
+ * @code
+ * Vector<float> result = where(a > 0.0f, a * b + c, sqrt(-a));
+ * @endcode
+ *
+ * The loop is simple enough for the compiler to vectorize. Large results are
+ * evaluated in parallel.
+ *
+ * Expressions hold pointers to the vectors they use, so they must be evaluated
+ * before any of those vectors is resized or destroyed.
+ */
+
+/**
+ * @brief Base class of all expressions.
+ *
+ * @tparam E The derived expression type.
+ */
+template<typename E>
+class VectorExpression
+{
+public:
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+namespace vector_expr
+{
+    /**
+     * @brief Below this number of elements expressions are evaluated on the calling thread.
+     */
+    constexpr size_t kParallelThreshold = 1 << 16;
+
+    /**
+     * @brief Leaf that reads the elements of a vector.
+     */
+    template<typename T>
+    class VectorRef : public VectorExpression<VectorRef<T>>
+    {
+    private:
+        const T* m_data;
+        size_t m_size;
+
+    public:
+        static constexpr bool is_scalar = false;
+
+        explicit VectorRef(const Vector<T>& vec) : m_data(vec.data()), m_size(vec.getSize()) {}
+
+        size_t getSize() const { return m_size; }
+        T operator[](size_t index) const { return m_data[index]; }
+    };
+
+    /**
+     * @brief Leaf that repeats one value for every element.
+     */
+    template<typename T>
+    class Scalar : public VectorExpression<Scalar<T>>
+    {
+    private:
+        T m_value;
+
+    public:
+        static constexpr bool is_scalar = true;
+
+        explicit Scalar(T value) : m_value(value) {}
+
+        size_t getSize() const { return 0; }
+        T operator[](size_t) const { return m_value; }
+    };
+
+    /**
+     * @brief Returns the common size of the operands, ignoring scalars.
+     *
+     * @throw std::invalid_argument If two vector operands have different sizes.
+     */
+    template<typename... Operands>
+    size_t common_size(const Operands&... operands)
+    {
+        size_t size = 0;
+        bool found = false;
+        auto check = [&](const auto& operand) {
+            if (std::decay_t<decltype(operand)>::is_scalar)
+            {
+                return;
+            }
+            if (found && operand.getSize() != size)
+            {
+                throw std::invalid_argument("Vector sizes don't match");
+            }
+            size = operand.getSize();
+            found = true;
+        };
+        (check(operands), ...);
+        return size;
+    }
+
+    template<typename Op, typename Operand>
+    class UnaryExpr : public VectorExpression<UnaryExpr<Op, Operand>>
+    {
+    private:
+        Operand m_operand;
+
+    public:
+        static constexpr bool is_scalar = false;
+
+        explicit UnaryExpr(const Operand& operand) : m_operand(operand) {}
+
+        size_t getSize() const { return m_operand.getSize(); }
+        auto operator[](size_t index) const { return Op()(m_operand[index]); }
+    };
+
+    template<typename Op, typename Left, typename Right>
+    class BinaryExpr : public VectorExpression<BinaryExpr<Op, Left, Right>>
+    {
+    private:
+        Left m_left;
+        Right m_right;
+        size_t m_size;
+
+    public:
+        static constexpr bool is_scalar = false;
+
+        BinaryExpr(const Left& left, const Right& right)
+            : m_left(left), m_right(right), m_size(common_size(left, right)) {}
+
+        size_t getSize() const { return m_size; }
+        auto operator[](size_t index) const { return Op()(m_left[index], m_right[index]); }
+    };
+
+    /**
+     * @brief Returns mask ? left : right without a branch.
+     *
+     * With floating-point values compilers keep a plain conditional as a branch, because
+     * they may not compute a side that might raise an exception. Selecting the bits with
+     * an integer mask keeps the evaluation loop vectorizable.
+     */
+    template<typename T>
+    T select(bool mask, T left, T right)
+    {
+        if constexpr (std::is_floating_point_v<T> && (sizeof(T) == 4 || sizeof(T) == 8))
+        {
+            using U = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            U left_bits;
+            U right_bits;
+            std::memcpy(&left_bits, &left, sizeof(T));
+            std::memcpy(&right_bits, &right, sizeof(T));
+            U keep = static_cast<U>(0) - static_cast<U>(mask);
+            U bits = (left_bits & keep) | (right_bits & ~keep);
+            T result;
+            std::memcpy(&result, &bits, sizeof(T));
+            return result;
+        }
+        else
+        {
+            return mask ? left : right;
+        }
+    }
+
+    template<typename Mask, typename Left, typename Right>
+    class WhereExpr : public VectorExpression<WhereExpr<Mask, Left, Right>>
+    {
+    private:
+        Mask m_mask;
+        Left m_left;
+        Right m_right;
+        size_t m_size;
+
+    public:
+        static constexpr bool is_scalar = false;
+
+        WhereExpr(const Mask& mask, const Left& left, const Right& right)
+            : m_mask(mask), m_left(left), m_right(right), m_size(common_size(mask, left, right)) {}
+
+        size_t getSize() const { return m_size; }
+
+        auto operator[](size_t index) const
+        {
+            using Result = std::common_type_t<decltype(m_left[index]), decltype(m_right[index])>;
+            return select(static_cast<bool>(m_mask[index]), static_cast<Result>(m_left[index]),
+                          static_cast<Result>(m_right[index]));
+        }
+    };
+
+    struct Sqrt { template<typename X> auto operator()(X x) const { return std::sqrt(x); } };
+    struct Abs { template<typename X> auto operator()(X x) const { return x < X(0) ? -x : x; } };
+    struct Exp { template<typename X> auto operator()(X x) const { return std::exp(x); } };
+    struct Log { template<typename X> auto operator()(X x) const { return std::log(x); } };
+    struct Min { template<typename X, typename Y> auto operator()(X x, Y y) const { return y < x ? y : x; } };
+    struct Max { template<typename X, typename Y> auto operator()(X x, Y y) const { return x < y ? y : x; } };
+
+    template<typename X>
+    struct is_numeric_vector : std::false_type {};
+
+    template<typename T>
+    struct is_numeric_vector<Vector<T>> : std::is_arithmetic<T> {};
+
+    template<typename X>
+    constexpr bool is_expression_v = std::is_base_of_v<VectorExpression<X>, X>;
+
+    /**
+     * @brief True for the types that make an operator build an expression: vectors and expressions.
+     */
+    template<typename X>
+    constexpr bool is_array_operand_v = is_numeric_vector<X>::value || is_expression_v<X>;
+
+    template<typename X>
+    constexpr bool is_operand_v = is_array_operand_v<X> || std::is_arithmetic_v<X>;
+
+    template<typename T>
+    VectorRef<T> as_expr(const Vector<T>& vec) { return VectorRef<T>(vec); }
+
+    template<typename E>
+    const E& as_expr(const VectorExpression<E>& expr) { return expr.self(); }
+
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    Scalar<T> as_expr(T value) { return Scalar<T>(value); }
+
+    template<typename X>
+    using expr_t = std::decay_t<decltype(as_expr(std::declval<const X&>()))>;
+
+    template<typename L, typename R>
+    using enable_binary_t = std::enable_if_t<is_operand_v<std::decay_t<L>> && is_operand_v<std::decay_t<R>>
+        && (is_array_operand_v<std::decay_t<L>> || is_array_operand_v<std::decay_t<R>>)>;
+
+    template<typename X>
+    using enable_unary_t = std::enable_if_t<is_array_operand_v<std::decay_t<X>>>;
+
+    template<typename Op, typename L, typename R>
+    BinaryExpr<Op, expr_t<L>, expr_t<R>> make_binary(const L& left, const R& right)
+    {
+        return BinaryExpr<Op, expr_t<L>, expr_t<R>>(as_expr(left), as_expr(right));
+    }
+
+    template<typename Op, typename X>
+    UnaryExpr<Op, expr_t<X>> make_unary(const X& operand)
+    {
+        return UnaryExpr<Op, expr_t<X>>(as_expr(operand));
+    }
+
+    /**
+     * @brief Evaluates elements [begin, end) of an expression into out.
+     */
+    template<typename T, typename E>
+    void evaluate_range(T* out, const E& expr, size_t begin, size_t end)
+    {
+        // No element depends on another, even when out is also an operand.
+#if defined(__clang__)
+#pragma clang loop vectorize(enable)
+#elif defined(__GNUC__)
+#pragma GCC ivdep
+#endif
+        for (size_t i = begin; i < end; ++i)
+        {
+            out[i] = static_cast<T>(expr[i]);
+        }
+    }
+}
+
+/**
+ * @brief Evaluates an expression into a vector.
+ *
+ * The destination is resized to the size of the expression. It may be one of the
+ * operands: every element is computed only from the elements at the same position.
+ *
+ * @param destination The vector that receives the result.
+ * @param expr The expression to evaluate.
+ * @param thread_count The number of threads for large expressions; 0 means default_thread_count().
+ */
+template<typename T, typename E>
+void evaluate(Vector<T>& destination, const VectorExpression<E>& expr, size_t thread_count = 0)
+{
+    const E& e = expr.self();
+    size_t size = e.getSize();
+    destination.resize(size);
+
+    T* out = destination.data();
+    parallel_for(0, size, size < vector_expr::kParallelThreshold ? 1 : thread_count,
+                 [&](size_t begin, size_t end, size_t) { vector_expr::evaluate_range(out, e, begin, end); });
+}
+
+/**
+ * @brief Sums the elements of an expression without storing them.
+ *
+ * @param expr The expression to sum.
+ * @return The sum, in the element type of the expression.
+ */
+template<typename E>
+auto sum(const VectorExpression<E>& expr)
+{
+    const E& e = expr.self();
+    decltype(e[0]) total{};
+    for (size_t i = 0; i < e.getSize(); ++i)
+    {
+        total += e[i];
+    }
+    return total;
+}
+
+template <typename T>
+template <typename E>
+Vector<T>::Vector(const VectorExpression<E>& expr) : Vector()
+{
+    evaluate(*this, expr);
+}
+
+template <typename T>
+template <typename E>
+Vector<T>& Vector<T>::operator=(const VectorExpression<E>& expr)
+{
+    evaluate(*this, expr);
+    return *this;
+}
+
+// Arithmetic: vector or expression with vector, expression or scalar.
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator+(const L& left, const R& right) { return vector_expr::make_binary<std::plus<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator-(const L& left, const R& right) { return vector_expr::make_binary<std::minus<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator*(const L& left, const R& right) { return vector_expr::make_binary<std::multiplies<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator/(const L& left, const R& right) { return vector_expr::make_binary<std::divides<>>(left, right); }
+
+template<typename X, typename = vector_expr::enable_unary_t<X>>
+auto operator-(const X& operand) { return vector_expr::make_unary<std::negate<>>(operand); }
+
+// Comparisons: expressions of bool, for use with where().
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator<(const L& left, const R& right) { return vector_expr::make_binary<std::less<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator>(const L& left, const R& right) { return vector_expr::make_binary<std::greater<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator<=(const L& left, const R& right) { return vector_expr::make_binary<std::less_equal<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator>=(const L& left, const R& right) { return vector_expr::make_binary<std::greater_equal<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator==(const L& left, const R& right) { return vector_expr::make_binary<std::equal_to<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator!=(const L& left, const R& right) { return vector_expr::make_binary<std::not_equal_to<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator&&(const L& left, const R& right) { return vector_expr::make_binary<std::logical_and<>>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto operator||(const L& left, const R& right) { return vector_expr::make_binary<std::logical_or<>>(left, right); }
+
+// Functions.
+
+template<typename X, typename = vector_expr::enable_unary_t<X>>
+auto sqrt(const X& operand) { return vector_expr::make_unary<vector_expr::Sqrt>(operand); }
+
+template<typename X, typename = vector_expr::enable_unary_t<X>>
+auto abs(const X& operand) { return vector_expr::make_unary<vector_expr::Abs>(operand); }
+
+template<typename X, typename = vector_expr::enable_unary_t<X>>
+auto exp(const X& operand) { return vector_expr::make_unary<vector_expr::Exp>(operand); }
+
+template<typename X, typename = vector_expr::enable_unary_t<X>>
+auto log(const X& operand) { return vector_expr::make_unary<vector_expr::Log>(operand); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto min(const L& left, const R& right) { return vector_expr::make_binary<vector_expr::Min>(left, right); }
+
+template<typename L, typename R, typename = vector_expr::enable_binary_t<L, R>>
+auto max(const L& left, const R& right) { return vector_expr::make_binary<vector_expr::Max>(left, right); }
+
+/**
+ * @brief Selects elements from two operands by a mask: mask[i] ? left[i] : right[i].
+ *
+ * @param mask Expression or vector of conditions, usually a comparison.
+ * @param left Values where the mask is true: a vector, an expression or a scalar.
+ * @param right Values where the mask is false: a vector, an expression or a scalar.
+ */
+template<typename M, typename L, typename R, typename = vector_expr::enable_unary_t<M>,
+         typename = std::enable_if_t<vector_expr::is_operand_v<L> && vector_expr::is_operand_v<R>>>
+auto where(const M& mask, const L& left, const R& right)
+{
+    using namespace vector_expr;
+    return WhereExpr<expr_t<M>, expr_t<L>, expr_t<R>>(as_expr(mask), as_expr(left), as_expr(right));
+}
+
+// Compound assignment, evaluated in place.
+
+template<typename T, typename R, typename = vector_expr::enable_binary_t<Vector<T>, R>>
+Vector<T>& operator+=(Vector<T>& left, const R& right) { return left = left + right; }
+
+template<typename T, typename R, typename = vector_expr::enable_binary_t<Vector<T>, R>>
+Vector<T>& operator-=(Vector<T>& left, const R& right) { return left = left - right; }
+
+template<typename T, typename R, typename = vector_expr::enable_binary_t<Vector<T>, R>>
+Vector<T>& operator*=(Vector<T>& left, const R& right) { return left = left * right; }
+
+template<typename T, typename R, typename = vector_expr::enable_binary_t<Vector<T>, R>>
+Vector<T>& operator/=(Vector<T>& left, const R& right) { return left = left / right; }
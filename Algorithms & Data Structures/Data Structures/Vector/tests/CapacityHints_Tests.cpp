@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "../include/CapacityHints.hpp"
+
+class CapacityHintsTest : public ::testing::Test {
+protected:
+
+    CapacityHintRegistry& m_registry = CapacityHintRegistry::instance();
+
+    void SetUp() override
+    {
+        m_registry.clear();
+        m_registry.set_percentile(0.9);
+    }
+
+    void TearDown() override
+    {
+        m_registry.clear();
+    }
+};
+
+TEST_F(CapacityHintsTest, HintIsHighPercentileOfRecentSizes)
+{
+    EXPECT_EQ(m_registry.hint("site"), 0);
+    for (size_t size = 1; size <= 10; ++size)
+    {
+        m_registry.record("site", size * 100);
+    }
+    EXPECT_EQ(m_registry.hint("site"), 900);
+
+    m_registry.set_percentile(1.0);
+    m_registry.record("site", 50);
+    EXPECT_EQ(m_registry.hint("site"), 1000);
+    EXPECT_THROW(m_registry.set_percentile(0.0), std::invalid_argument);
+}
+
+TEST_F(CapacityHintsTest, HintedVectorLearnsFromEarlierRuns)
+{
+    auto build = [](size_t count) {
+        HintedVector<int> values("parse_batch");
+        size_t initial_capacity = values.getCapacity();
+        for (size_t i = 0; i < count; ++i)
+        {
+            values.push_back(static_cast<int>(i));
+        }
+        return initial_capacity;
+    };
+
+    EXPECT_EQ(build(1000), 0);
+    EXPECT_EQ(build(1000), 1000);
+
+    HintedVector<int> moved("moved");
+    moved.push_back(1);
+    HintedVector<int> target(std::move(moved));
+    EXPECT_EQ(target.tag(), "moved");
+}
+
+TEST_F(CapacityHintsTest, MovesDontRecordEmptiedVectors)
+{
+    // With the median as hint, a few recorded zeros would be enough to poison it.
+    m_registry.set_percentile(0.5);
+    auto build = [](bool take) -> Vector<int> {
+        HintedVector<int> values("returned");
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+        if (take)
+        {
+            return values.take();
+        }
+        return values;
+    };
+
+    EXPECT_EQ(build(true).getSize(), 1000);
+    EXPECT_EQ(m_registry.hint("returned"), 1000);
+    for (int run = 0; run < 5; ++run)
+    {
+        EXPECT_EQ(build(false).getSize(), 1000);
+    }
+    EXPECT_EQ(m_registry.hint("returned"), 1000);
+
+    m_registry.set_percentile(1.0);
+    {
+        HintedVector<int> target("assigned");
+        target.resize(300, 0);
+        HintedVector<int> source("assigned");
+        source.resize(10, 0);
+        target = std::move(source);
+        EXPECT_EQ(m_registry.hint("assigned"), 300);
+    }
+    EXPECT_EQ(m_registry.hint("assigned"), 300);
+}
+
+TEST_F(CapacityHintsTest, SourceLocationTags)
+{
+    size_t capacities[2];
+    for (size_t run = 0; run < 2; ++run)
+    {
+        HintedVector<double> values;
+        capacities[run] = values.getCapacity();
+        values.resize(64, 0.0);
+        EXPECT_NE(values.tag().find("CapacityHints_Tests.cpp:"), std::string::npos);
+    }
+    EXPECT_EQ(capacities[0], 0);
+    EXPECT_EQ(capacities[1], 64);
+}
+
+TEST_F(CapacityHintsTest, SaveAndLoad)
+{
+    m_registry.record("a.cpp:10", 300);
+    m_registry.record("b.cpp:20", 40);
+
+    std::stringstream stream;
+    m_registry.save(stream);
+    m_registry.clear();
+
+    EXPECT_EQ(m_registry.load(stream), 2);
+    EXPECT_EQ(m_registry.hint("a.cpp:10"), 300);
+    EXPECT_EQ(m_registry.hint("b.cpp:20"), 40);
+
+    std::stringstream malformed("12x tag\n");
+    EXPECT_THROW(m_registry.load(malformed), std::runtime_error);
+    std::stringstream too_large("99999999999999999999999 tag\n");
+    EXPECT_THROW(m_registry.load(too_large), std::runtime_error);
+}
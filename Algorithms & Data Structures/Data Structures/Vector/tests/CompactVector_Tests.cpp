@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "../include/CompactVector.hpp"
+
+class CompactVectorTest : public ::testing::Test {
+protected:
+
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+// Test object layout
+
+TEST_F(CompactVectorTest, ObjectSize)
+{
+    EXPECT_EQ(sizeof(CompactVector<int>), sizeof(void*) + 2 * sizeof(uint32_t));
+    EXPECT_EQ(sizeof(ThinVector<int>), sizeof(void*));
+}
+
+// Test CompactVector
+
+TEST_F(CompactVectorTest, PushBackAndCapacity)
+{
+    CompactVector<int> vec;
+    EXPECT_EQ(vec.getCapacity(), 0);
+    vec.push_back(10);
+    vec.push_back(20);
+    vec.push_back(30);
+
+    EXPECT_EQ(vec.getSize(), 3);
+    EXPECT_EQ(vec.getCapacity(), 4);
+    EXPECT_EQ(vec[0], 10);
+    EXPECT_EQ(vec[2], 30);
+}
+
+TEST_F(CompactVectorTest, CopyAndMove)
+{
+    CompactVector<std::string> vec1 = {"a", "b", "c"};
+    CompactVector<std::string> vec2(vec1);
+    EXPECT_EQ(vec2.getSize(), 3);
+    EXPECT_EQ(vec2[1], "b");
+
+    CompactVector<std::string> vec3(std::move(vec1));
+    EXPECT_EQ(vec3.getSize(), 3);
+    EXPECT_EQ(vec1.getSize(), 0);
+    EXPECT_EQ(vec1.getCapacity(), 0);
+}
+
+TEST_F(CompactVectorTest, InsertErase)
+{
+    CompactVector<int> vec = {1, 2, 3, 4};
+    vec.insert(2, 7);
+    EXPECT_EQ(vec.getSize(), 5);
+    EXPECT_EQ(vec[2], 7);
+    EXPECT_EQ(vec[3], 3);
+    vec.erase(0);
+    EXPECT_EQ(vec[0], 2);
+    EXPECT_THROW(vec.erase(4), std::out_of_range);
+    EXPECT_THROW(vec.insert(6, 1), std::out_of_range);
+}
+
+TEST_F(CompactVectorTest, ReserveBeyondLimit)
+{
+    CompactVector<char> vec;
+    EXPECT_THROW(vec.reserve(CompactVector<char>::max_size + 1), std::length_error);
+}
+
+// Test ThinVector
+
+TEST_F(CompactVectorTest, ThinVectorEmptyDoesNotAllocate)
+{
+    ThinVector<int> vec;
+    EXPECT_EQ(vec.getSize(), 0);
+    EXPECT_EQ(vec.getCapacity(), 0);
+    EXPECT_TRUE(vec.empty());
+    EXPECT_TRUE(vec.begin() == vec.end());
+    EXPECT_THROW(vec.pop_back(), std::out_of_range);
+}
+
+TEST_F(CompactVectorTest, ThinVectorPushBack)
+{
+    ThinVector<std::string> vec;
+    vec.push_back("Hello");
+    vec.push_back("World");
+    vec.push_back(vec[0]);
+
+    EXPECT_EQ(vec.getSize(), 3);
+    EXPECT_EQ(vec.getCapacity(), 4);
+    EXPECT_EQ(vec[0], "Hello");
+    EXPECT_EQ(vec[2], "Hello");
+}
+
+TEST_F(CompactVectorTest, ThinVectorInsertErase)
+{
+    ThinVector<std::string> vec = {"a", "b", "c", "d"};
+    vec.insert(1, "x");
+    EXPECT_EQ(vec.getSize(), 5);
+    EXPECT_EQ(vec[1], "x");
+    EXPECT_EQ(vec[2], "b");
+    vec.insert(5, "e");
+    EXPECT_EQ(vec[5], "e");
+    vec.erase(0);
+    EXPECT_EQ(vec[0], "x");
+    EXPECT_EQ(vec.getSize(), 5);
+    EXPECT_THROW(vec.at(5), std::out_of_range);
+}
+
+TEST_F(CompactVectorTest, ThinVectorResizeAndShrink)
+{
+    ThinVector<int> vec;
+    vec.resize(5, 3);
+    EXPECT_EQ(vec.getSize(), 5);
+    EXPECT_EQ(vec[4], 3);
+    vec.resize(2);
+    EXPECT_EQ(vec.getSize(), 2);
+    EXPECT_EQ(vec.getCapacity(), 5);
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.getCapacity(), 2);
+    vec.clear();
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.getCapacity(), 0);
+}
+
+TEST_F(CompactVectorTest, ThinVectorCopyAndMove)
+{
+    ThinVector<std::string> vec1 = {"a", "b"};
+    ThinVector<std::string> vec2;
+    vec2 = vec1;
+    EXPECT_EQ(vec2.getSize(), 2);
+    EXPECT_EQ(vec2[1], "b");
+
+    ThinVector<std::string> vec3;
+    vec3 = std::move(vec2);
+    EXPECT_EQ(vec3.getSize(), 2);
+    EXPECT_EQ(vec2.getSize(), 0);
+
+    int count = 0;
+    for (auto &&element : vec3)
+    {
+        EXPECT_EQ(element, vec1[count++]);
+    }
+    EXPECT_EQ(count, 2);
+}
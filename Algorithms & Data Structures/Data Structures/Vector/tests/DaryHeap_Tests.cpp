@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include "../include/DaryHeap.hpp"
+
+class DaryHeapTest : public ::testing::Test {
+protected:
+
+    Vector<int> m_values;
+
+    void SetUp() override
+    {
+        std::mt19937 random(42);
+        for (int i = 0; i < 1000; ++i)
+        {
+            m_values.push_back(static_cast<int>(random() % 500));
+        }
+    }
+
+    void TearDown() override {}
+
+    template<size_t D>
+    void expectPopsInOrder(DaryHeap<int, D>& heap)
+    {
+        int previous = heap.top();
+        size_t count = 0;
+        while (!heap.empty())
+        {
+            int value = heap.pop_top();
+            EXPECT_LE(value, previous);
+            previous = value;
+            ++count;
+        }
+        EXPECT_EQ(count, m_values.getSize());
+    }
+};
+
+TEST_F(DaryHeapTest, EmptyHeap)
+{
+    DaryHeap<int> heap;
+    EXPECT_TRUE(heap.empty());
+    EXPECT_EQ(heap.getSize(), 0);
+    EXPECT_THROW(heap.top(), std::out_of_range);
+    EXPECT_THROW(heap.pop(), std::out_of_range);
+}
+
+TEST_F(DaryHeapTest, PushPopAllArities)
+{
+    DaryHeap<int, 2> binary;
+    DaryHeap<int, 4> quaternary;
+    DaryHeap<int, 8> octonary;
+    for (size_t i = 0; i < m_values.getSize(); ++i)
+    {
+        binary.push(m_values[i]);
+        quaternary.push(m_values[i]);
+        octonary.push(m_values[i]);
+    }
+    EXPECT_EQ(quaternary.top(), *std::max_element(m_values.data(), m_values.data() + m_values.getSize()));
+    expectPopsInOrder(binary);
+    expectPopsInOrder(quaternary);
+    expectPopsInOrder(octonary);
+}
+
+TEST_F(DaryHeapTest, MakeHeap)
+{
+    DaryHeap<int, 4> heap(m_values);
+    EXPECT_EQ(heap.getSize(), m_values.getSize());
+    expectPopsInOrder(heap);
+}
+
+TEST_F(DaryHeapTest, PushBulk)
+{
+    Vector<int> first;
+    Vector<int> second;
+    for (size_t i = 0; i < m_values.getSize(); ++i)
+    {
+        (i < 990 ? first : second).push_back(m_values[i]);
+    }
+
+    DaryHeap<int, 8> heap;
+    heap.push_bulk(first);
+    heap.push_bulk(second);
+    expectPopsInOrder(heap);
+}
+
+TEST_F(DaryHeapTest, MinHeapWithStrings)
+{
+    DaryHeap<std::string, 4, std::greater<std::string>> heap;
+    heap.push("pear");
+    heap.push("apple");
+    heap.push("fig");
+
+    EXPECT_EQ(heap.pop_top(), "apple");
+    EXPECT_EQ(heap.pop_top(), "fig");
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+}
+
+TEST_F(DaryHeapTest, IndexedDecreaseKey)
+{
+    IndexedDaryHeap<int, 4, std::greater<int>> heap;
+    for (size_t id = 0; id < 20; ++id)
+    {
+        heap.push(id, 100 + static_cast<int>(id));
+    }
+    EXPECT_THROW(heap.push(3, 1), std::invalid_argument);
+    EXPECT_EQ(heap.top_id(), 0);
+
+    heap.decrease_key(17, 5);
+    EXPECT_EQ(heap.top_id(), 17);
+    EXPECT_EQ(heap.priority(17), 5);
+    EXPECT_THROW(heap.decrease_key(17, 50), std::invalid_argument);
+
+    EXPECT_EQ(heap.pop(), 17);
+    EXPECT_FALSE(heap.contains(17));
+    EXPECT_THROW(heap.priority(17), std::out_of_range);
+
+    int previous = heap.top_priority();
+    while (!heap.empty())
+    {
+        int priority = heap.top_priority();
+        EXPECT_GE(priority, previous);
+        previous = priority;
+        heap.pop();
+    }
+}
+
+TEST_F(DaryHeapTest, SiblingGroupsStartOnCacheLines)
+{
+    DaryHeap<uint64_t, 8> heap;
+    IndexedDaryHeap<double, 4> indexed;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        heap.push(static_cast<uint64_t>(m_values[i]));
+        indexed.push(i, static_cast<double>(m_values[i]));
+
+        // The root sits just before the first sibling group; every later group
+        // starts D * sizeof(node) = 64 bytes after the previous one.
+        uintptr_t group = reinterpret_cast<uintptr_t>(&heap.top() + 1);
+        ASSERT_EQ(group % 64, 0u);
+        // An indexed node is a double priority followed by an 8-byte id.
+        uintptr_t indexed_group = reinterpret_cast<uintptr_t>(&indexed.top_priority()) + 16;
+        ASSERT_EQ(indexed_group % 64, 0u);
+    }
+
+    DaryHeap<uint64_t, 8> copy = heap;
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&copy.top() + 1) % 64, 0u);
+    EXPECT_EQ(copy.pop_top(), heap.pop_top());
+}
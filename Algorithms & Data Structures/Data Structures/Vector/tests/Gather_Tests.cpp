@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include "../include/Gather.hpp"
+
+class GatherTest : public ::testing::Test {
+protected:
+
+    Vector<double> m_source;
+    Vector<uint32_t> m_indices;
+
+    void SetUp() override
+    {
+        std::mt19937 random(5);
+        for (size_t i = 0; i < 50000; ++i)
+        {
+            m_source.push_back(static_cast<double>(i) * 0.5);
+        }
+        for (size_t i = 0; i < 40003; ++i)
+        {
+            m_indices.push_back(static_cast<uint32_t>(random() % m_source.getSize()));
+        }
+    }
+
+    void TearDown() override {}
+
+    template<typename T, typename Index>
+    static void expectGathered(const Vector<T>& source, const Vector<Index>& indices, const Vector<T>& out)
+    {
+        ASSERT_EQ(out.getSize(), indices.getSize());
+        for (size_t i = 0; i < indices.getSize(); ++i)
+        {
+            ASSERT_EQ(out[i], source[indices[i]]);
+        }
+    }
+};
+
+TEST_F(GatherTest, GatherAllWidths)
+{
+    Vector<double> out;
+    gather(m_source, m_indices, out);
+    expectGathered(m_source, m_indices, out);
+
+    Vector<int32_t> ints;
+    Vector<uint64_t> wide_indices;
+    for (size_t i = 0; i < m_source.getSize(); ++i)
+    {
+        ints.push_back(-static_cast<int32_t>(i));
+    }
+    for (size_t i = 0; i < m_indices.getSize(); ++i)
+    {
+        wide_indices.push_back(m_indices[i]);
+    }
+
+    Vector<int32_t> int_out;
+    gather(ints, m_indices, int_out);
+    expectGathered(ints, m_indices, int_out);
+    gather(ints, wide_indices, int_out);
+    expectGathered(ints, wide_indices, int_out);
+    gather(m_source, wide_indices, out);
+    expectGathered(m_source, wide_indices, out);
+}
+
+TEST_F(GatherTest, GatherOptions)
+{
+    GatherOptions options;
+    options.prefetch_distance = 0;
+    Vector<double> out;
+    gather(m_source, m_indices, out, options);
+    expectGathered(m_source, m_indices, out);
+
+    options.prefetch_distance = 64;
+    options.thread_count = 4;
+    gather(m_source, m_indices, out, options);
+    expectGathered(m_source, m_indices, out);
+
+    Vector<std::string> words = {"zero", "one", "two"};
+    Vector<size_t> picks = {2, 0, 2};
+    Vector<std::string> picked;
+    gather(words, picks, picked);
+    EXPECT_EQ(picked[0], "two");
+    EXPECT_EQ(picked[1], "zero");
+}
+
+TEST_F(GatherTest, ScatterIsInverseOfGather)
+{
+    // A permutation, so that indices are unique and the scatter can run in parallel.
+    Vector<uint32_t> permutation;
+    for (uint32_t i = 0; i < m_source.getSize(); ++i)
+    {
+        permutation.push_back(i);
+    }
+    std::shuffle(permutation.data(), permutation.data() + permutation.getSize(), std::mt19937(9));
+
+    Vector<double> shuffled;
+    gather(m_source, permutation, shuffled);
+
+    GatherOptions options;
+    options.thread_count = 3;
+    Vector<double> restored;
+    restored.resize(m_source.getSize(), -1.0);
+    scatter(shuffled, permutation, restored, options);
+    for (size_t i = 0; i < m_source.getSize(); ++i)
+    {
+        ASSERT_EQ(restored[i], m_source[i]);
+    }
+
+    EXPECT_THROW(scatter(shuffled, m_indices, restored), std::invalid_argument);
+}
+
+TEST_F(GatherTest, ScatterAddAccumulatesRepeats)
+{
+    Vector<int64_t> histogram;
+    histogram.resize(m_source.getSize(), 0);
+    Vector<int64_t> ones;
+    ones.resize(m_indices.getSize(), 1);
+    scatter_add(ones, m_indices, histogram);
+
+    int64_t total = 0;
+    for (size_t i = 0; i < histogram.getSize(); ++i)
+    {
+        total += histogram[i];
+    }
+    EXPECT_EQ(total, static_cast<int64_t>(m_indices.getSize()));
+    EXPECT_EQ(histogram[m_indices[0]] >= 1, true);
+
+    Vector<size_t> last = {1, 1};
+    Vector<int64_t> values = {5, 7};
+    scatter(values, last, histogram);
+    EXPECT_EQ(histogram[1], 7);
+}
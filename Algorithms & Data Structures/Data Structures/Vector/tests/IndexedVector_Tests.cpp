@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "../include/IndexedVector.hpp"
+
+struct Record
+{
+    int id = 0;
+    std::string name;
+};
+
+struct RecordId
+{
+    int operator()(const Record& record) const { return record.id; }
+};
+
+class IndexedVectorTest : public ::testing::Test {
+protected:
+
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(IndexedVectorTest, PushBackAndFind)
+{
+    IndexedVector<Record, RecordId> records;
+    records.push_back({1, "one"});
+    records.push_back({2, "two"});
+
+    EXPECT_EQ(records.getSize(), 2);
+    EXPECT_TRUE(records.contains(2));
+    EXPECT_FALSE(records.contains(3));
+    EXPECT_EQ(records.index_of(2), 1);
+    EXPECT_EQ(records.at_key(1).name, "one");
+    EXPECT_EQ(records.find(3), nullptr);
+    EXPECT_THROW(records.at_key(3), std::out_of_range);
+}
+
+TEST_F(IndexedVectorTest, DuplicateKey)
+{
+    IndexedVector<Record, RecordId> records;
+    records.push_back({1, "one"});
+    EXPECT_THROW(records.push_back({1, "again"}), std::invalid_argument);
+    EXPECT_EQ(records.getSize(), 1);
+    EXPECT_EQ(records.at_key(1).name, "one");
+}
+
+TEST_F(IndexedVectorTest, MemberPointerKey)
+{
+    IndexedVector<Record, int Record::*> records(&Record::id);
+    records.push_back({5, "five"});
+    EXPECT_EQ(records.find(5)->name, "five");
+}
+
+TEST_F(IndexedVectorTest, SwapErase)
+{
+    IndexedVector<Record, RecordId> records;
+    for (int i = 0; i < 5; ++i)
+    {
+        records.push_back({i, std::to_string(i)});
+    }
+
+    records.swap_erase(1);
+    EXPECT_EQ(records.getSize(), 4);
+    EXPECT_FALSE(records.contains(1));
+    EXPECT_EQ(records[1].id, 4);
+    EXPECT_EQ(records.index_of(4), 1);
+
+    EXPECT_TRUE(records.erase_key(4));
+    EXPECT_FALSE(records.erase_key(4));
+    EXPECT_EQ(records.index_of(3), 1);
+    EXPECT_THROW(records.swap_erase(3), std::out_of_range);
+}
+
+TEST_F(IndexedVectorTest, ManyElementsStayIndexed)
+{
+    IndexedVector<Record, RecordId> records;
+    const int count = 10000;
+    for (int i = 0; i < count; ++i)
+    {
+        records.push_back({i * 7, ""});
+    }
+    for (int i = 0; i < count; i += 2)
+    {
+        EXPECT_TRUE(records.erase_key(i * 7));
+    }
+    for (int i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(records.contains(i * 7), i % 2 == 1);
+    }
+    for (size_t i = 0; i < records.getSize(); ++i)
+    {
+        EXPECT_EQ(records.index_of(records[i].id), i);
+    }
+}
+
+TEST_F(IndexedVectorTest, InsertionOrderIteration)
+{
+    IndexedVector<Record, RecordId> records;
+    records.reserve(3);
+    records.push_back({30, ""});
+    records.push_back({10, ""});
+    records.push_back({20, ""});
+
+    int expected[] = {30, 10, 20};
+    int i = 0;
+    for (auto &&record : records)
+    {
+        EXPECT_EQ(record.id, expected[i++]);
+    }
+
+    records.clear();
+    EXPECT_TRUE(records.empty());
+    EXPECT_FALSE(records.contains(30));
+    records.push_back({30, ""});
+    EXPECT_TRUE(records.contains(30));
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <string>
+#include "../include/IoBuffer.hpp"
+
+class IoBufferTest : public ::testing::Test {
+protected:
+
+    int m_pipe[2];
+
+    void SetUp() override
+    {
+        ASSERT_EQ(pipe(m_pipe), 0);
+    }
+
+    void TearDown() override
+    {
+        close(m_pipe[0]);
+        if (m_pipe[1] >= 0)
+        {
+            close(m_pipe[1]);
+        }
+    }
+
+    static Vector<char> bytes(const std::string& text)
+    {
+        Vector<char> result;
+        for (char c : text)
+        {
+            result.push_back(c);
+        }
+        return result;
+    }
+
+    static std::string text(const Vector<char>& buffer)
+    {
+        return std::string(buffer.data(), buffer.getSize());
+    }
+};
+
+TEST_F(IoBufferTest, AppendFromFdReadsIntoSpareCapacity)
+{
+    Vector<char> message = bytes("hello, world");
+    ASSERT_EQ(write_to_fd(m_pipe[1], message), message.getSize());
+
+    Vector<char> buffer = bytes(">");
+    IoResult first = append_from_fd(buffer, m_pipe[0], 5);
+    EXPECT_EQ(first.bytes, 5);
+    EXPECT_FALSE(first.end_of_file);
+    EXPECT_EQ(text(buffer), ">hello");
+
+    append_from_fd(buffer, m_pipe[0], 4096);
+    EXPECT_EQ(text(buffer), ">hello, world");
+
+    close(m_pipe[1]);
+    m_pipe[1] = -1;
+    IoResult last = append_from_fd(buffer, m_pipe[0], 4096);
+    EXPECT_TRUE(last.end_of_file);
+    EXPECT_EQ(buffer.getSize(), 13);
+}
+
+TEST_F(IoBufferTest, NonBlockingReadReportsWouldBlock)
+{
+    fcntl(m_pipe[0], F_SETFL, fcntl(m_pipe[0], F_GETFL) | O_NONBLOCK);
+    Vector<std::byte> buffer;
+    IoResult result = append_from_fd(buffer, m_pipe[0], 128);
+    EXPECT_TRUE(result.would_block);
+    EXPECT_EQ(buffer.getSize(), 0);
+
+    EXPECT_THROW(append_from_fd(buffer, -1, 128), std::system_error);
+}
+
+TEST_F(IoBufferTest, WritevSendsSeveralVectors)
+{
+    Vector<char> header = bytes("HEAD ");
+    Vector<char> empty;
+    Vector<char> body = bytes("body");
+    EXPECT_EQ(writev_to_fd(m_pipe[1], header, empty, body), 9);
+    EXPECT_EQ(write_to_fd(m_pipe[1], body, 2), 2);
+    EXPECT_THROW(write_to_fd(m_pipe[1], body, 5), std::out_of_range);
+
+    Vector<char> received;
+    append_from_fd(received, m_pipe[0], 64);
+    EXPECT_EQ(text(received), "HEAD bodydy");
+}
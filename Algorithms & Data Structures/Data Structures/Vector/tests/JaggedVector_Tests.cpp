@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "../include/JaggedVector.hpp"
+
+class JaggedVectorTest : public ::testing::Test {
+protected:
+
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(JaggedVectorTest, DefaultConstructor)
+{
+    JaggedVector<int> jagged;
+    EXPECT_TRUE(jagged.empty());
+    EXPECT_EQ(jagged.getRowCount(), 0);
+    EXPECT_EQ(jagged.getValueCount(), 0);
+}
+
+TEST_F(JaggedVectorTest, PushRow)
+{
+    JaggedVector<int> jagged;
+    jagged.push_row({1, 2, 3});
+    jagged.push_row({});
+    Vector<int> third = {4, 5};
+    jagged.push_row(third);
+
+    EXPECT_EQ(jagged.getRowCount(), 3);
+    EXPECT_EQ(jagged.getValueCount(), 5);
+    EXPECT_EQ(jagged.rowSize(0), 3);
+    EXPECT_EQ(jagged.rowSize(1), 0);
+    EXPECT_EQ(jagged.row(2)[1], 5);
+    EXPECT_EQ(jagged.values()[3], 4);
+}
+
+TEST_F(JaggedVectorTest, PushBackToLastRow)
+{
+    JaggedVector<std::string> jagged;
+    EXPECT_THROW(jagged.push_back_to_last_row("a"), std::out_of_range);
+
+    jagged.push_row({"a"});
+    jagged.push_row({"b"});
+    jagged.push_back_to_last_row("c");
+
+    EXPECT_EQ(jagged.rowSize(0), 1);
+    EXPECT_EQ(jagged.rowSize(1), 2);
+    EXPECT_EQ(jagged.row(1)[1], "c");
+}
+
+TEST_F(JaggedVectorTest, PopRow)
+{
+    JaggedVector<int> jagged;
+    jagged.push_row({1, 2});
+    jagged.push_row({3});
+    jagged.pop_row();
+
+    EXPECT_EQ(jagged.getRowCount(), 1);
+    EXPECT_EQ(jagged.getValueCount(), 2);
+    jagged.pop_row();
+    EXPECT_THROW(jagged.pop_row(), std::out_of_range);
+}
+
+TEST_F(JaggedVectorTest, RowAtOutOfRange)
+{
+    JaggedVector<int> jagged;
+    jagged.push_row({1});
+    EXPECT_EQ(jagged.rowAt(0)[0], 1);
+    EXPECT_THROW(jagged.rowAt(1), std::out_of_range);
+}
+
+TEST_F(JaggedVectorTest, BuildFromCounts)
+{
+    Vector<size_t> counts = {2, 0, 3};
+    JaggedVector<int> jagged;
+    jagged.push_row({9});
+    jagged.build_from_counts(counts);
+
+    EXPECT_EQ(jagged.getRowCount(), 3);
+    EXPECT_EQ(jagged.getValueCount(), 5);
+
+    for (size_t i = 0; i < jagged.getRowCount(); ++i)
+    {
+        int k = 0;
+        for (int& value : jagged.row(i))
+        {
+            value = static_cast<int>(i * 10) + k++;
+        }
+    }
+    EXPECT_EQ(jagged.row(0)[1], 1);
+    EXPECT_EQ(jagged.row(2)[0], 20);
+    EXPECT_EQ(jagged.row(2)[2], 22);
+}
+
+TEST_F(JaggedVectorTest, NestedConversion)
+{
+    Vector<Vector<int>> nested;
+    nested.push_back({1, 2});
+    nested.push_back({});
+    nested.push_back({3, 4, 5});
+
+    JaggedVector<int> jagged(nested);
+    EXPECT_EQ(jagged.getRowCount(), 3);
+    EXPECT_EQ(jagged.row(2)[2], 5);
+
+    Vector<Vector<int>> back = jagged.to_nested();
+    EXPECT_EQ(back.getSize(), 3);
+    EXPECT_EQ(back[0].getSize(), 2);
+    EXPECT_EQ(back[1].getSize(), 0);
+    EXPECT_EQ(back[2][0], 3);
+}
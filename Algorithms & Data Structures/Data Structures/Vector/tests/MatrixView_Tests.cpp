@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "../include/MatrixView.hpp"
+
+class MatrixViewTest : public ::testing::Test {
+protected:
+
+    static constexpr size_t kRows = 70;
+    static constexpr size_t kCols = 45;
+
+    Vector<double> m_storage;
+
+    void SetUp() override
+    {
+        m_storage.resize(kRows * kCols, 0.0);
+        for (size_t i = 0; i < m_storage.getSize(); ++i)
+        {
+            m_storage[i] = static_cast<double>(i);
+        }
+    }
+
+    void TearDown() override {}
+};
+
+TEST_F(MatrixViewTest, LayoutsMapIndices)
+{
+    MatrixView<double> row_major(m_storage, kRows, kCols);
+    EXPECT_DOUBLE_EQ(row_major(2, 3), 2.0 * kCols + 3.0);
+
+    MatrixView<double> column_major(m_storage, kRows, kCols, Layout::ColumnMajor);
+    EXPECT_DOUBLE_EQ(column_major(2, 3), 3.0 * kRows + 2.0);
+
+    Vector<int> tiles;
+    tiles.resize(MatrixView<int>::required_size(5, 5, Layout::Tiled, 2, 2), 0);
+    EXPECT_EQ(tiles.getSize(), 36);
+    MatrixView<int> tiled(tiles, 5, 5, Layout::Tiled, 2, 2);
+    EXPECT_EQ(tiled.offset(0, 1), 1);
+    EXPECT_EQ(tiled.offset(1, 0), 2);
+    EXPECT_EQ(tiled.offset(0, 2), 4);
+    EXPECT_EQ(tiled.offset(2, 0), 12);
+
+    EXPECT_THROW(row_major.at(kRows, 0), std::out_of_range);
+    EXPECT_THROW(MatrixView<double>(m_storage, kRows + 1, kCols), std::invalid_argument);
+}
+
+TEST_F(MatrixViewTest, TransposedViewSharesStorage)
+{
+    MatrixView<double> matrix(m_storage, kRows, kCols);
+    MatrixView<double> flipped = matrix.transposed();
+    EXPECT_EQ(flipped.rows(), kCols);
+    EXPECT_EQ(flipped.layout(), Layout::ColumnMajor);
+
+    flipped(4, 7) = -1.0;
+    EXPECT_DOUBLE_EQ(matrix(7, 4), -1.0);
+}
+
+TEST_F(MatrixViewTest, TransposeAndConvertLayout)
+{
+    MatrixView<const double> source(static_cast<const Vector<double>&>(m_storage), kRows, kCols);
+
+    Vector<double> transposed_storage;
+    transposed_storage.resize(kRows * kCols, 0.0);
+    MatrixView<double> transposed(transposed_storage, kCols, kRows);
+    transpose(source, transposed);
+
+    Vector<double> tiled_storage;
+    tiled_storage.resize(MatrixView<double>::required_size(kRows, kCols, Layout::Tiled, 16, 8), 0.0);
+    MatrixView<double> tiled(tiled_storage, kRows, kCols, Layout::Tiled, 16, 8);
+    convert_layout(source, tiled);
+
+    for (size_t r = 0; r < kRows; ++r)
+    {
+        for (size_t c = 0; c < kCols; ++c)
+        {
+            ASSERT_DOUBLE_EQ(transposed(c, r), source(r, c));
+            ASSERT_DOUBLE_EQ(tiled(r, c), source(r, c));
+        }
+    }
+    EXPECT_THROW(transpose(source, MatrixView<double>(m_storage, kRows, kCols)), std::invalid_argument);
+}
+
+TEST_F(MatrixViewTest, TransposeInPlace)
+{
+    MatrixView<double> square(m_storage, 40, 40);
+    transpose_in_place(square);
+    for (size_t r = 0; r < 40; ++r)
+    {
+        for (size_t c = 0; c < 40; ++c)
+        {
+            ASSERT_DOUBLE_EQ(square(r, c), static_cast<double>(c * 40 + r));
+        }
+    }
+    EXPECT_THROW(transpose_in_place(MatrixView<double>(m_storage, kRows, kCols)), std::invalid_argument);
+}
+
+TEST_F(MatrixViewTest, MatmulMatchesNaiveProduct)
+{
+    MatrixView<double> a(m_storage, kRows, kCols);
+    Vector<double> b_storage;
+    b_storage.resize(kCols * 33, 0.0);
+    MatrixView<double> b(b_storage, kCols, 33, Layout::ColumnMajor);
+    for (size_t r = 0; r < kCols; ++r)
+    {
+        for (size_t c = 0; c < 33; ++c)
+        {
+            b(r, c) = static_cast<double>((r + 2 * c) % 7) - 3.0;
+        }
+    }
+
+    for (Layout layout : {Layout::RowMajor, Layout::ColumnMajor, Layout::Tiled})
+    {
+        Vector<double> result_storage;
+        result_storage.resize(MatrixView<double>::required_size(kRows, 33, layout), 0.0);
+        MatrixView<double> result(result_storage, kRows, 33, layout);
+        matmul(a, b, result);
+
+        for (size_t i = 0; i < kRows; i += 7)
+        {
+            for (size_t j = 0; j < 33; j += 5)
+            {
+                double expected = 0.0;
+                for (size_t k = 0; k < kCols; ++k)
+                {
+                    expected += a(i, k) * b(k, j);
+                }
+                ASSERT_DOUBLE_EQ(result(i, j), expected);
+            }
+        }
+    }
+}
+
+TEST_F(MatrixViewTest, RowAndColumnSums)
+{
+    MatrixView<double> matrix(m_storage, kRows, kCols, Layout::ColumnMajor);
+    Vector<double> rows;
+    Vector<double> cols;
+    row_sums(matrix, rows);
+    column_sums(matrix, cols);
+    ASSERT_EQ(rows.getSize(), kRows);
+    ASSERT_EQ(cols.getSize(), kCols);
+
+    // Column c holds c * kRows + r for r in [0, kRows).
+    EXPECT_DOUBLE_EQ(cols[2], 2.0 * kRows * kRows + kRows * (kRows - 1) / 2.0);
+    EXPECT_DOUBLE_EQ(rows[1], kRows * kCols * (kCols - 1) / 2.0 + kCols);
+}
+
+TEST_F(MatrixViewTest, TensorViewStrides)
+{
+    TensorView<double, 3> tensor(m_storage, {5, 7, 9});
+    EXPECT_EQ(tensor.stride(0), 63);
+    EXPECT_EQ(tensor.stride(2), 1);
+    EXPECT_EQ(tensor.getSize(), 315);
+    EXPECT_DOUBLE_EQ(tensor(1, 2, 3), 63.0 + 18.0 + 3.0);
+
+    TensorView<double, 3> column_major(m_storage, {5, 7, 9}, Layout::ColumnMajor);
+    EXPECT_EQ(column_major.stride(0), 1);
+    EXPECT_DOUBLE_EQ(column_major(1, 2, 3), 1.0 + 10.0 + 105.0);
+
+    EXPECT_THROW((TensorView<double, 2>(m_storage, {100, 100})), std::invalid_argument);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "../include/Numa.hpp"
+
+class NumaTest : public ::testing::Test {
+protected:
+
+    static constexpr size_t kCount = 1 << 19;
+
+    NumaOptions m_options;
+
+    void SetUp() override
+    {
+        m_options.thread_count = 4;
+    }
+
+    void TearDown() override {}
+};
+
+TEST_F(NumaTest, ParsesCpuLists)
+{
+    Vector<int> cpus = numa_detail::parse_cpu_list("0-3,8,10-11\n");
+    ASSERT_EQ(cpus.getSize(), 7);
+    EXPECT_EQ(cpus[3], 3);
+    EXPECT_EQ(cpus[4], 8);
+    EXPECT_EQ(cpus[6], 11);
+    EXPECT_GE(numa_node_count(), 1);
+}
+
+TEST_F(NumaTest, FillWithBothPlacements)
+{
+    for (NumaPlacement placement : {NumaPlacement::Partitioned, NumaPlacement::Interleaved})
+    {
+        m_options.placement = placement;
+        Vector<double> values;
+        numa_fill(values, kCount, 2.5, m_options);
+        ASSERT_EQ(values.getSize(), kCount);
+        for (size_t i = 0; i < kCount; i += 511)
+        {
+            ASSERT_DOUBLE_EQ(values[i], 2.5);
+        }
+        EXPECT_DOUBLE_EQ(values[kCount - 1], 2.5);
+
+        numa_fill(values, 10, 1.0, m_options);
+        EXPECT_EQ(values.getSize(), 10);
+        EXPECT_DOUBLE_EQ(values[9], 1.0);
+    }
+}
+
+TEST_F(NumaTest, ReserveKeepsElementsAndCopyMatches)
+{
+    Vector<uint64_t> values = {1, 2, 3};
+    numa_reserve(values, kCount, m_options);
+    EXPECT_EQ(values.getCapacity(), kCount);
+    ASSERT_EQ(values.getSize(), 3);
+    EXPECT_EQ(values[2], 3);
+
+    values.resize(kCount, 7);
+    Vector<uint64_t> copy = numa_copy(values, m_options);
+    ASSERT_EQ(copy.getSize(), kCount);
+    EXPECT_EQ(copy[1], 2);
+    EXPECT_EQ(copy[kCount - 1], 7);
+}
+
+TEST_F(NumaTest, LocalityCoversEveryPage)
+{
+    Vector<double> values;
+    numa_fill(values, kCount, 0.0, m_options);
+    NumaLocality report = numa_locality(values);
+    EXPECT_GE(report.total_pages, kCount * sizeof(double) / numa_detail::page_size());
+    if (report.available)
+    {
+        size_t placed = 0;
+        for (size_t pages : report.pages_per_node)
+        {
+            placed += pages;
+        }
+        EXPECT_EQ(report.unplaced_pages, 0);
+        EXPECT_EQ(placed, report.total_pages);
+    }
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include "../include/ShardedAppender.hpp"
+
+class ShardedAppenderTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(ShardedAppenderTest, FinalizeKeepsShardOrder)
+{
+    ShardedAppender<std::string> appender(3);
+    EXPECT_EQ(appender.getShardCount(), 3);
+    appender.push_back(2, "c1");
+    appender.push_back(0, "a1");
+    appender.push_back(2, "c2");
+    appender.push_back(0, "a2");
+    EXPECT_EQ(appender.getSize(), 4);
+    EXPECT_THROW(appender.shard(3), std::out_of_range);
+
+    Vector<std::string> merged = {"start"};
+    appender.finalize(merged);
+    ASSERT_EQ(merged.getSize(), 5);
+    EXPECT_EQ(merged[0], "start");
+    EXPECT_EQ(merged[1], "a1");
+    EXPECT_EQ(merged[2], "a2");
+    EXPECT_EQ(merged[3], "c1");
+    EXPECT_EQ(merged[4], "c2");
+    EXPECT_EQ(appender.getSize(), 0);
+}
+
+TEST_F(ShardedAppenderTest, ParallelAppendAndMerge)
+{
+    const size_t workers = 4;
+    const size_t per_worker = 50000;
+    ShardedAppender<size_t> appender(workers);
+
+    Vector<std::thread> threads;
+    for (size_t id = 0; id < workers; ++id)
+    {
+        threads.push_back(std::thread([&appender, id, per_worker]() {
+            // Uneven shards: worker id appends (id + 1) * per_worker / 2 values.
+            for (size_t i = 0; i < (id + 1) * per_worker / 2; ++i)
+            {
+                appender.push_back(id, id * 1000000 + i);
+            }
+        }));
+    }
+    for (auto &&thread : threads)
+    {
+        thread.join();
+    }
+
+    Vector<size_t> merged = appender.finalize(3);
+    ASSERT_EQ(merged.getSize(), per_worker * 5);
+    size_t position = 0;
+    for (size_t id = 0; id < workers; ++id)
+    {
+        for (size_t i = 0; i < (id + 1) * per_worker / 2; ++i, ++position)
+        {
+            ASSERT_EQ(merged[position], id * 1000000 + i);
+        }
+    }
+}
+
+TEST_F(ShardedAppenderTest, ReuseAfterFinalize)
+{
+    ShardedAppender<int> appender(2);
+    appender.reserve(8);
+    appender.push_back(1, 5);
+    Vector<int> first = appender.finalize();
+    EXPECT_EQ(first.getSize(), 1);
+    EXPECT_EQ(appender.shard(1).getCapacity(), 8);
+
+    Vector<int> empty = appender.finalize();
+    EXPECT_EQ(empty.getSize(), 0);
+
+    appender.shard(0).push_back(7);
+    appender.clear();
+    EXPECT_EQ(appender.getSize(), 0);
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "../include/ShrinkPolicy.hpp"
+
+class ShrinkPolicyTest : public ::testing::Test {
+protected:
+
+    ShrinkPolicy m_policy;
+
+    void SetUp() override
+    {
+        m_policy.shrink_divisor = 4;
+        m_policy.patience = 3;
+        m_policy.min_capacity = 4;
+    }
+
+    void TearDown() override {}
+};
+
+TEST_F(ShrinkPolicyTest, ShrinksAfterPatience)
+{
+    ShrinkingVector<int> vec(m_policy);
+    for (int i = 0; i < 64; ++i)
+    {
+        vec.push_back(i);
+    }
+    EXPECT_EQ(vec.getCapacity(), 64);
+
+    while (vec.getSize() > 15)
+    {
+        vec.pop_back();
+    }
+    EXPECT_EQ(vec.getCapacity(), 64);
+
+    vec.pop_back();
+    EXPECT_EQ(vec.getCapacity(), 64);
+    vec.pop_back();
+    EXPECT_EQ(vec.getSize(), 13);
+    EXPECT_EQ(vec.getCapacity(), 26);
+    EXPECT_EQ(vec[12], 12);
+}
+
+TEST_F(ShrinkPolicyTest, BriefDipDoesNotShrink)
+{
+    ShrinkingVector<int> vec(m_policy);
+    vec.resize(64);
+    vec.resize(8);
+    vec.resize(9);
+    vec.resize(40);
+    vec.pop_back();
+    EXPECT_EQ(vec.getCapacity(), 64);
+}
+
+TEST_F(ShrinkPolicyTest, ClearReleasesAfterPatience)
+{
+    ShrinkingVector<int> vec(m_policy);
+    vec.resize(100);
+    vec.clear();
+    EXPECT_EQ(vec.getCapacity(), 100);
+    vec.push_back(1);
+    vec.push_back(2);
+    EXPECT_EQ(vec.getCapacity(), 4);
+    EXPECT_EQ(vec[1], 2);
+}
+
+TEST_F(ShrinkPolicyTest, TrimAll)
+{
+    size_t registered = TrimRegistry::instance().getSize();
+    {
+        ShrinkingVector<int64_t> small(m_policy, true);
+        ShrinkingVector<int64_t> large(m_policy, true);
+        small.reserve(10);
+        large.reserve(1000);
+        large.push_back(1);
+        EXPECT_EQ(TrimRegistry::instance().getSize(), registered + 2);
+
+        EXPECT_EQ(trim_all(1), 999 * sizeof(int64_t));
+        EXPECT_EQ(large.getCapacity(), 1);
+        EXPECT_EQ(small.getCapacity(), 10);
+
+        EXPECT_EQ(trim_all(SIZE_MAX), 10 * sizeof(int64_t));
+        EXPECT_EQ(small.getCapacity(), 0);
+        EXPECT_EQ(TrimRegistry::instance().reclaimable_bytes(), 0);
+    }
+    EXPECT_EQ(TrimRegistry::instance().getSize(), registered);
+}
+
+TEST_F(ShrinkPolicyTest, MovedVectorStaysRegistered)
+{
+    size_t registered = TrimRegistry::instance().getSize();
+    ShrinkingVector<int> vec(m_policy, true);
+    vec.reserve(8);
+    ShrinkingVector<int> moved(std::move(vec));
+    EXPECT_EQ(TrimRegistry::instance().getSize(), registered + 2);
+    EXPECT_EQ(trim_all(SIZE_MAX), 8 * sizeof(int));
+    EXPECT_EQ(moved.getCapacity(), 0);
+}
+
+TEST_F(ShrinkPolicyTest, EveryMutatorAppliesPolicy)
+{
+    ShrinkingVector<int> vec(m_policy);
+    vec.assign(64, 1);
+    EXPECT_EQ(vec.getCapacity(), 64);
+
+    // assign, insert and erase all count as operations of the policy.
+    vec.assign(10, 2);
+    vec.insert(0, 3);
+    vec.erase(0);
+    EXPECT_EQ(vec.getSize(), 10);
+    EXPECT_EQ(vec.getCapacity(), 20);
+    EXPECT_EQ(vec.values()[9], 2);
+
+    int sum = 0;
+    for (int value : vec)
+    {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 20);
+}
+
+TEST_F(ShrinkPolicyTest, RegistrationFollowsCopiesAndAssignment)
+{
+    size_t registered = TrimRegistry::instance().getSize();
+    {
+        Vector<ShrinkingVector<int>> vectors;
+        for (int i = 0; i < 100; ++i)
+        {
+            vectors.push_back(ShrinkingVector<int>(m_policy, true));
+        }
+        ShrinkingVector<int> copy = vectors[5];
+        EXPECT_EQ(TrimRegistry::instance().getSize(), registered + 101);
+
+        // Assignment adopts the registration of the source.
+        vectors[0] = ShrinkingVector<int>(m_policy, false);
+        EXPECT_EQ(TrimRegistry::instance().getSize(), registered + 100);
+    }
+    EXPECT_EQ(TrimRegistry::instance().getSize(), registered);
+}
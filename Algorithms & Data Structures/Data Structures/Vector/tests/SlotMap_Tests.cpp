@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "../include/SlotMap.hpp"
+
+class SlotMapTest : public ::testing::Test {
+protected:
+
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(SlotMapTest, InsertAndGet)
+{
+    SlotMap<std::string> map;
+    SlotHandle a = map.insert("a");
+    SlotHandle b = map.insert("b");
+
+    EXPECT_EQ(map.getSize(), 2);
+    EXPECT_EQ(*map.get(a), "a");
+    EXPECT_EQ(map.at(b), "b");
+    EXPECT_NE(a, b);
+}
+
+TEST_F(SlotMapTest, RemoveKeepsOtherHandles)
+{
+    SlotMap<int> map;
+    SlotHandle a = map.insert(1);
+    SlotHandle b = map.insert(2);
+    SlotHandle c = map.insert(3);
+
+    EXPECT_TRUE(map.remove(a));
+    EXPECT_EQ(map.getSize(), 2);
+    EXPECT_FALSE(map.contains(a));
+    EXPECT_EQ(map.at(b), 2);
+    EXPECT_EQ(map.at(c), 3);
+    EXPECT_FALSE(map.remove(a));
+}
+
+TEST_F(SlotMapTest, StaleHandleAfterReuse)
+{
+    SlotMap<int> map;
+    SlotHandle a = map.insert(1);
+    map.remove(a);
+    SlotHandle b = map.insert(2);
+
+    EXPECT_EQ(a.index, b.index);
+    EXPECT_NE(a.generation, b.generation);
+    EXPECT_EQ(map.get(a), nullptr);
+    EXPECT_THROW(map.at(a), std::out_of_range);
+    EXPECT_EQ(map.at(b), 2);
+}
+
+TEST_F(SlotMapTest, DenseIteration)
+{
+    SlotMap<int> map;
+    SlotHandle handles[5];
+    for (int i = 0; i < 5; ++i)
+    {
+        handles[i] = map.insert(i);
+    }
+    map.remove(handles[1]);
+    map.remove(handles[3]);
+
+    int sum = 0;
+    for (auto &&value : map)
+    {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 0 + 2 + 4);
+
+    for (size_t i = 0; i < map.getSize(); ++i)
+    {
+        EXPECT_EQ(*map.get(map.handle_at(i)), *(map.begin() + static_cast<std::ptrdiff_t>(i)));
+    }
+}
+
+TEST_F(SlotMapTest, Clear)
+{
+    SlotMap<int> map;
+    SlotHandle a = map.insert(1);
+    map.clear();
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(a));
+    SlotHandle b = map.insert(2);
+    EXPECT_FALSE(map.contains(a));
+    EXPECT_TRUE(map.contains(b));
+}
+
+TEST_F(SlotMapTest, InvalidHandle)
+{
+    SlotMap<int> map;
+    EXPECT_FALSE(map.contains(SlotHandle{7, 0}));
+    EXPECT_FALSE(map.remove(SlotHandle{7, 0}));
+}
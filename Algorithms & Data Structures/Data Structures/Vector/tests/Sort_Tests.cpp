@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include "../include/Sort.hpp"
+
+class SortTest : public ::testing::Test {
+protected:
+
+    struct Record
+    {
+        int32_t key;
+        size_t order;
+        std::string payload;
+    };
+
+    void SetUp() override {}
+
+    void TearDown() override {}
+
+    template<typename T, typename Compare = std::less<T>>
+    static bool isSorted(const Vector<T>& values, Compare comp = Compare())
+    {
+        return std::is_sorted(values.data(), values.data() + values.getSize(), comp);
+    }
+
+    static Vector<int> randomInts(size_t count, int modulo)
+    {
+        std::mt19937 random(7);
+        Vector<int> values;
+        for (size_t i = 0; i < count; ++i)
+        {
+            values.push_back(static_cast<int>(random() % modulo) - modulo / 2);
+        }
+        return values;
+    }
+};
+
+TEST_F(SortTest, SortPatterns)
+{
+    Vector<int> random = randomInts(10000, 1000000);
+    Vector<int> few_unique = randomInts(10000, 4);
+    Vector<int> ascending;
+    Vector<int> descending;
+    Vector<int> organ_pipe;
+    for (int i = 0; i < 10000; ++i)
+    {
+        ascending.push_back(i);
+        descending.push_back(-i);
+        organ_pipe.push_back(i < 5000 ? i : 10000 - i);
+    }
+
+    for (Vector<int>* values : {&random, &few_unique, &ascending, &descending, &organ_pipe})
+    {
+        Vector<int> expected = *values;
+        std::sort(expected.data(), expected.data() + expected.getSize());
+        sort(*values);
+        EXPECT_TRUE(std::equal(values->data(), values->data() + values->getSize(), expected.data()));
+    }
+}
+
+TEST_F(SortTest, SortWithComparator)
+{
+    Vector<double> values;
+    for (int i = 0; i < 500; ++i)
+    {
+        values.push_back((i * 37) % 101 + 0.5);
+    }
+    sort(values, std::greater<double>());
+    EXPECT_TRUE(isSorted(values, std::greater<double>()));
+
+    Vector<std::string> words = {"pear", "apple", "fig", "banana", "cherry"};
+    sort(words, [](const std::string& a, const std::string& b) { return a.size() < b.size(); });
+    EXPECT_EQ(words[0], "fig");
+    EXPECT_EQ(words[4].size(), 6);
+
+    Vector<int> empty;
+    sort(empty);
+    EXPECT_EQ(empty.getSize(), 0);
+}
+
+TEST_F(SortTest, RadixSortIntegers)
+{
+    Vector<int> values = randomInts(5000, 2000000);
+    values.push_back(std::numeric_limits<int>::min());
+    values.push_back(std::numeric_limits<int>::max());
+    radix_sort(values);
+    EXPECT_TRUE(isSorted(values));
+    EXPECT_EQ(values[0], std::numeric_limits<int>::min());
+
+    Vector<uint8_t> bytes = {200, 3, 255, 0, 17};
+    radix_sort(bytes);
+    EXPECT_TRUE(isSorted(bytes));
+}
+
+TEST_F(SortTest, RadixSortFloats)
+{
+    Vector<double> values = {3.5, -0.0, -2.25, 0.0, 1e300, -1e-300, -7.0, 2.0};
+    radix_sort(values);
+    EXPECT_TRUE(isSorted(values));
+    EXPECT_TRUE(std::signbit(values[3]));
+    EXPECT_FALSE(std::signbit(values[4]));
+
+    Vector<float> floats = {1.5f, -1.5f, 0.25f};
+    radix_sort(floats);
+    EXPECT_EQ(floats[0], -1.5f);
+    EXPECT_EQ(floats[2], 1.5f);
+}
+
+TEST_F(SortTest, RadixSortByKeyIsStable)
+{
+    Vector<Record> records;
+    std::mt19937 random(3);
+    for (size_t i = 0; i < 3000; ++i)
+    {
+        records.push_back(Record{static_cast<int32_t>(random() % 50) - 25, i, std::to_string(i)});
+    }
+
+    radix_sort(records, [](const Record& record) { return record.key; });
+    for (size_t i = 1; i < records.getSize(); ++i)
+    {
+        ASSERT_LE(records[i - 1].key, records[i].key);
+        if (records[i - 1].key == records[i].key)
+        {
+            ASSERT_LT(records[i - 1].order, records[i].order);
+        }
+        ASSERT_EQ(records[i].payload, std::to_string(records[i].order));
+    }
+}
+
+TEST_F(SortTest, ParallelRadixSort)
+{
+    std::mt19937_64 random(11);
+    Vector<uint64_t> values;
+    Vector<std::pair<uint32_t, uint32_t>> pairs;
+    for (uint32_t i = 0; i < 200000; ++i)
+    {
+        values.push_back(random());
+        pairs.push_back({static_cast<uint32_t>(random() % 1000), i});
+    }
+
+    Vector<uint64_t> expected = values;
+    std::sort(expected.data(), expected.data() + expected.getSize());
+    parallel_radix_sort(values, 4);
+    EXPECT_TRUE(std::equal(values.data(), values.data() + values.getSize(), expected.data()));
+
+    parallel_radix_sort(pairs, [](const std::pair<uint32_t, uint32_t>& pair) { return pair.first; }, 3);
+    for (size_t i = 1; i < pairs.getSize(); ++i)
+    {
+        ASSERT_TRUE(pairs[i - 1].first < pairs[i].first
+                    || (pairs[i - 1].first == pairs[i].first && pairs[i - 1].second < pairs[i].second));
+    }
+}
+
+TEST_F(SortTest, ParallelForRethrows)
+{
+    Vector<int> hits;
+    hits.resize(100, 0);
+    parallel_for(0, 100, 4, [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            ++hits[i];
+        }
+    });
+    EXPECT_EQ(std::count(hits.data(), hits.data() + hits.getSize(), 1), 100);
+
+    EXPECT_THROW(parallel_for(0, 100, 4, [](size_t, size_t, size_t worker) {
+        if (worker == 2)
+        {
+            throw std::runtime_error("worker failed");
+        }
+    }), std::runtime_error);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "../include/SparseVector.hpp"
+
+class SparseVectorTest : public ::testing::Test {
+protected:
+
+    Vector<double> m_dense;
+
+    void SetUp() override
+    {
+        m_dense.resize(1000, 0.0);
+        for (size_t i = 0; i < m_dense.getSize(); i += 97)
+        {
+            m_dense[i] = static_cast<double>(i) + 0.5;
+        }
+    }
+
+    void TearDown() override {}
+};
+
+TEST_F(SparseVectorTest, ConvertsBothWays)
+{
+    SparseVector<double> sparse(m_dense);
+    EXPECT_EQ(sparse.getSize(), 1000);
+    EXPECT_EQ(sparse.getNonZeroCount(), 11);
+    EXPECT_DOUBLE_EQ(sparse.get(97), 97.5);
+    EXPECT_DOUBLE_EQ(sparse.get(98), 0.0);
+
+    Vector<double> dense = sparse.to_dense();
+    ASSERT_EQ(dense.getSize(), m_dense.getSize());
+    for (size_t i = 0; i < dense.getSize(); ++i)
+    {
+        ASSERT_DOUBLE_EQ(dense[i], m_dense[i]);
+    }
+}
+
+TEST_F(SparseVectorTest, SetKeepsOrderAndDropsDefaults)
+{
+    SparseVector<int> sparse(10);
+    sparse.set(7, 70);
+    sparse.set(2, 20);
+    sparse.set(5, 50);
+    sparse.set(5, 55);
+    sparse.set(2, 0);
+
+    ASSERT_EQ(sparse.getNonZeroCount(), 2);
+    size_t expected_index[] = {5, 7};
+    int expected_value[] = {55, 70};
+    size_t k = 0;
+    for (auto entry : sparse)
+    {
+        EXPECT_EQ(entry.index, expected_index[k]);
+        EXPECT_EQ(entry.value, expected_value[k]);
+        ++k;
+    }
+
+    EXPECT_THROW(sparse.set(10, 1), std::out_of_range);
+    EXPECT_THROW(sparse.at(10), std::out_of_range);
+
+    sparse.resize(6);
+    EXPECT_EQ(sparse.getNonZeroCount(), 1);
+    EXPECT_EQ(sparse.at(5), 55);
+}
+
+TEST_F(SparseVectorTest, DotAndAxpy)
+{
+    SparseVector<double> sparse(m_dense);
+    Vector<double> ones;
+    ones.resize(1000, 1.0);
+
+    double expected = 0.0;
+    for (size_t i = 0; i < m_dense.getSize(); ++i)
+    {
+        expected += m_dense[i];
+    }
+    EXPECT_DOUBLE_EQ(dot(sparse, ones), expected);
+
+    axpy(2.0, sparse, ones);
+    EXPECT_DOUBLE_EQ(ones[0], 2.0);
+    EXPECT_DOUBLE_EQ(ones[194], 1.0 + 2.0 * 194.5);
+    EXPECT_DOUBLE_EQ(ones[1], 1.0);
+
+    Vector<double> shorter;
+    shorter.resize(10, 0.0);
+    EXPECT_THROW(dot(sparse, shorter), std::invalid_argument);
+    EXPECT_THROW(axpy(1.0, sparse, shorter), std::invalid_argument);
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "../include/StreamLoader.hpp"
+
+class StreamLoaderTest : public ::testing::Test {
+protected:
+
+    std::string m_path;
+
+    void SetUp() override
+    {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        m_path = (std::filesystem::temp_directory_path() / (std::string("StreamLoaderTest_") + info->name())).string();
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(m_path);
+    }
+
+    void writeFile(const std::string& contents)
+    {
+        std::ofstream file(m_path, std::ios::binary);
+        file << contents;
+    }
+};
+
+TEST_F(StreamLoaderTest, ChunksInFileOrder)
+{
+    std::string contents;
+    for (int i = 0; i < 1000; ++i)
+    {
+        contents += static_cast<char>('a' + i % 26);
+    }
+    writeFile(contents);
+
+    StreamLoaderOptions options;
+    options.chunk_size = 7;
+    options.memory_budget = 21;
+    options.io_threads = 3;
+    StreamLoader loader(options);
+
+    std::string result;
+    EXPECT_TRUE(loader.for_each_chunk(m_path, [&](std::span<const char> chunk) {
+        EXPECT_LE(chunk.size(), 7u);
+        result.append(chunk.data(), chunk.size());
+        return true;
+    }));
+    EXPECT_EQ(result, contents);
+}
+
+TEST_F(StreamLoaderTest, LoadLines)
+{
+    writeFile("10\n20\r\n30\n\n40");
+
+    StreamLoaderOptions options;
+    options.chunk_size = 3;
+    StreamLoader loader(options);
+
+    Vector<int> numbers;
+    EXPECT_TRUE(loader.load_lines(m_path, [](std::string_view line) {
+        return line.empty() ? -1 : std::stoi(std::string(line));
+    }, numbers));
+
+    EXPECT_EQ(numbers.getSize(), 5);
+    EXPECT_EQ(numbers[0], 10);
+    EXPECT_EQ(numbers[1], 20);
+    EXPECT_EQ(numbers[2], 30);
+    EXPECT_EQ(numbers[3], -1);
+    EXPECT_EQ(numbers[4], 40);
+}
+
+TEST_F(StreamLoaderTest, LoadBinary)
+{
+    const uint32_t count = 10000;
+    {
+        std::ofstream file(m_path, std::ios::binary);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            file.write(reinterpret_cast<const char*>(&i), sizeof(i));
+        }
+    }
+
+    StreamLoaderOptions options;
+    options.chunk_size = 1001;
+    options.io_threads = 2;
+    StreamLoader loader(options);
+
+    Vector<uint32_t> values;
+    values.push_back(42);
+    EXPECT_TRUE(loader.load_binary(m_path, values));
+    EXPECT_EQ(values.getSize(), count + 1);
+    EXPECT_EQ(values[0], 42u);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(values[i + 1], i);
+    }
+}
+
+TEST_F(StreamLoaderTest, ConsumerStops)
+{
+    writeFile("a\nb\nc\nd\n");
+    StreamLoader loader;
+
+    int lines = 0;
+    EXPECT_FALSE(loader.for_each_line(m_path, [&](std::string_view) {
+        return ++lines < 2;
+    }));
+    EXPECT_EQ(lines, 2);
+}
+
+TEST_F(StreamLoaderTest, Cancel)
+{
+    writeFile(std::string(1000, 'x'));
+
+    StreamLoaderOptions options;
+    options.chunk_size = 10;
+    StreamLoader loader(options);
+
+    int chunks = 0;
+    EXPECT_FALSE(loader.for_each_chunk(m_path, [&](std::span<const char>) {
+        if (++chunks == 3)
+        {
+            loader.cancel();
+        }
+        return true;
+    }));
+    EXPECT_EQ(chunks, 3);
+    EXPECT_TRUE(loader.cancelled());
+}
+
+TEST_F(StreamLoaderTest, CancelBeforeLoad)
+{
+    writeFile(std::string(1000, 'x'));
+
+    StreamLoaderOptions options;
+    options.chunk_size = 10;
+    StreamLoader loader(options);
+    loader.cancel();
+    EXPECT_TRUE(loader.cancelled());
+
+    int chunks = 0;
+    auto count = [&](std::span<const char>) {
+        ++chunks;
+        return true;
+    };
+    EXPECT_FALSE(loader.for_each_chunk(m_path, count));
+    EXPECT_EQ(chunks, 0);
+    EXPECT_TRUE(loader.cancelled());
+
+    EXPECT_TRUE(loader.for_each_chunk(m_path, count));
+    EXPECT_EQ(chunks, 100);
+    EXPECT_FALSE(loader.cancelled());
+}
+
+TEST_F(StreamLoaderTest, MissingFile)
+{
+    StreamLoader loader;
+    Vector<char> out;
+    EXPECT_THROW(loader.load_binary(m_path + "_missing", out), std::runtime_error);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include "../include/StringVector.hpp"
+
+class StringVectorTest : public ::testing::Test {
+protected:
+
+    StringVector<> m_strings;
+
+    void SetUp() override
+    {
+        m_strings.push_back("alpha");
+        m_strings.push_back("");
+        m_strings.push_back("gamma");
+    }
+
+    void TearDown() override {}
+};
+
+TEST_F(StringVectorTest, PushBackAndAccess)
+{
+    EXPECT_EQ(m_strings.getSize(), 3);
+    EXPECT_EQ(m_strings.getByteCount(), 10);
+    EXPECT_EQ(m_strings[0], "alpha");
+    EXPECT_EQ(m_strings[1], "");
+    EXPECT_EQ(m_strings.length(2), 5);
+    EXPECT_EQ(m_strings.at(2), "gamma");
+    EXPECT_THROW(m_strings.at(3), std::out_of_range);
+
+    std::string joined(m_strings.chars().data(), m_strings.chars().size());
+    EXPECT_EQ(joined, "alphagamma");
+}
+
+TEST_F(StringVectorTest, ManyStringsSurviveGrowth)
+{
+    StringVector<uint64_t> strings;
+    for (int i = 0; i < 10000; ++i)
+    {
+        EXPECT_EQ(strings.push_back(std::to_string(i)), static_cast<size_t>(i));
+    }
+    for (int i = 0; i < 10000; i += 997)
+    {
+        EXPECT_EQ(strings[i], std::to_string(i));
+    }
+}
+
+TEST_F(StringVectorTest, PushBackOwnElementAcrossGrowth)
+{
+    // Each push_back reads from the buffer it may reallocate.
+    for (int i = 0; i < 200; ++i)
+    {
+        m_strings.push_back(m_strings[i % 3 == 1 ? 2 : 0]);
+    }
+    EXPECT_EQ(m_strings[3], "alpha");
+    EXPECT_EQ(m_strings[4], "gamma");
+    EXPECT_EQ(m_strings[202], "gamma");
+
+    size_t index = m_strings.push_back(m_strings[4].substr(1, 3));
+    EXPECT_EQ(m_strings[index], "amm");
+}
+
+TEST_F(StringVectorTest, InternOwnSubstringAcrossGrowth)
+{
+    // Each intern hashes a view of the buffer it may reallocate.
+    std::string source = std::string(64, 'x') + std::string(64, 'y');
+    m_strings.push_back(source);
+    for (size_t i = 1; i <= 64; ++i)
+    {
+        EXPECT_EQ(m_strings.intern(m_strings[3].substr(i, 64)), 3 + i);
+    }
+    for (size_t i = 1; i <= 64; ++i)
+    {
+        EXPECT_EQ(m_strings.intern(source.substr(i, 64)), 3 + i);
+    }
+    EXPECT_EQ(m_strings.getSize(), 68);
+}
+
+TEST_F(StringVectorTest, AppendRangeAndIteration)
+{
+    Vector<std::string> words = {"one", "two", "three"};
+    StringVector<> strings(words);
+    strings.append_range(words);
+    EXPECT_EQ(strings.getSize(), 6);
+
+    size_t i = 0;
+    for (std::string_view word : strings)
+    {
+        EXPECT_EQ(word, words[i % 3]);
+        ++i;
+    }
+    EXPECT_EQ(i, 6);
+}
+
+TEST_F(StringVectorTest, InternDeduplicates)
+{
+    m_strings.push_back("alpha");
+    EXPECT_EQ(m_strings.intern("alpha"), 0);
+    EXPECT_EQ(m_strings.intern("gamma"), 2);
+    EXPECT_EQ(m_strings.intern("delta"), 4);
+    EXPECT_EQ(m_strings.intern("delta"), 4);
+    EXPECT_EQ(m_strings.getSize(), 5);
+
+    m_strings.push_back("epsilon");
+    EXPECT_EQ(m_strings.find("epsilon"), 5);
+    EXPECT_EQ(m_strings.find("zeta"), StringVector<>::npos);
+}
+
+TEST_F(StringVectorTest, PopBackAndClear)
+{
+    EXPECT_EQ(m_strings.intern("delta"), 3);
+    m_strings.pop_back();
+    EXPECT_EQ(m_strings.getSize(), 3);
+    EXPECT_EQ(m_strings.getByteCount(), 10);
+    EXPECT_EQ(m_strings.find("delta"), StringVector<>::npos);
+
+    m_strings.clear();
+    EXPECT_TRUE(m_strings.empty());
+    EXPECT_THROW(m_strings.pop_back(), std::out_of_range);
+    EXPECT_EQ(m_strings.intern("alpha"), 0);
+}
+
+TEST_F(StringVectorTest, OffsetOverflow)
+{
+    StringVector<uint8_t> strings;
+    strings.push_back(std::string(200, 'a'));
+    EXPECT_THROW(strings.push_back(std::string(100, 'b')), std::length_error);
+    EXPECT_EQ(strings.getSize(), 1);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <sstream>
+#include "../include/TrackedVector.hpp"
+
+class TrackedVectorTest : public ::testing::Test {
+protected:
+
+    // 16 elements of 8 bytes per block.
+    TrackedVector<int64_t> m_vec{128};
+
+    void SetUp() override
+    {
+        m_vec.resize(100, 0);
+        m_vec.clear_dirty();
+    }
+
+    void TearDown() override {}
+};
+
+TEST_F(TrackedVectorTest, WritesMarkBlocks)
+{
+    EXPECT_EQ(m_vec.getBlockSize(), 16);
+    EXPECT_FALSE(m_vec.is_dirty());
+
+    m_vec[3] = 7;
+    m_vec[40] += 2;
+    m_vec.modify(47) = 1;
+    int64_t read = m_vec[90];
+    EXPECT_EQ(read, 0);
+    EXPECT_EQ(m_vec[40], 2);
+
+    Vector<DirtyRange> ranges = m_vec.dirty_ranges();
+    ASSERT_EQ(ranges.getSize(), 2);
+    EXPECT_EQ(ranges[0].begin, 0);
+    EXPECT_EQ(ranges[0].end, 16);
+    EXPECT_EQ(ranges[1].begin, 32);
+    EXPECT_EQ(ranges[1].end, 48);
+    EXPECT_THROW(m_vec.modify(100), std::out_of_range);
+}
+
+TEST_F(TrackedVectorTest, StructuralChanges)
+{
+    m_vec.push_back(5);
+    Vector<DirtyRange> ranges = m_vec.dirty_ranges();
+    ASSERT_EQ(ranges.getSize(), 1);
+    EXPECT_EQ(ranges[0].begin, 96);
+    EXPECT_EQ(ranges[0].end, 101);
+    m_vec.clear_dirty();
+
+    m_vec.erase(50);
+    ranges = m_vec.dirty_ranges();
+    ASSERT_EQ(ranges.getSize(), 1);
+    EXPECT_EQ(ranges[0].begin, 48);
+    EXPECT_EQ(ranges[0].end, 100);
+    m_vec.clear_dirty();
+
+    m_vec.pop_back();
+    EXPECT_TRUE(m_vec.dirty_ranges().empty());
+    EXPECT_TRUE(m_vec.is_dirty());
+}
+
+TEST_F(TrackedVectorTest, IncrementalSnapshots)
+{
+    for (size_t i = 0; i < m_vec.getSize(); ++i)
+    {
+        m_vec[i] = static_cast<int64_t>(i);
+    }
+    std::stringstream full;
+    m_vec.write_full(full);
+    Vector<int64_t> replica;
+    apply_changes(full, replica);
+    ASSERT_EQ(replica.getSize(), 100);
+    EXPECT_EQ(replica[99], 99);
+
+    m_vec[20] = -1;
+    m_vec.resize(110, 3);
+    std::stringstream delta;
+    EXPECT_EQ(m_vec.write_changes(delta), 16 + 14);
+    EXPECT_FALSE(m_vec.is_dirty());
+    apply_changes(delta, replica);
+    ASSERT_EQ(replica.getSize(), 110);
+    for (size_t i = 0; i < m_vec.getSize(); ++i)
+    {
+        ASSERT_EQ(replica[i], m_vec[i]);
+    }
+
+    std::stringstream garbage("not a snapshot at all");
+    EXPECT_THROW(apply_changes(garbage, replica), std::runtime_error);
+    std::stringstream wrong_type;
+    m_vec.write_full(wrong_type);
+    Vector<int32_t> narrow;
+    EXPECT_THROW(apply_changes(wrong_type, narrow), std::runtime_error);
+}
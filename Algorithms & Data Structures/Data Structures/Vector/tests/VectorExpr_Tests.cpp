@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "../include/VectorExpr.hpp"
+
+class VectorExprTest : public ::testing::Test {
+protected:
+
+    Vector<double> m_a;
+    Vector<double> m_b;
+    Vector<double> m_c;
+
+    void SetUp() override
+    {
+        m_a = {1.0, -4.0, 9.0, -16.0};
+        m_b = {2.0, 3.0, 4.0, 5.0};
+        m_c = {0.5, 0.5, 0.5, 0.5};
+    }
+
+    void TearDown() override {}
+};
+
+TEST_F(VectorExprTest, ArithmeticIsFused)
+{
+    Vector<double> result = m_a * m_b + m_c;
+    ASSERT_EQ(result.getSize(), 4);
+    EXPECT_DOUBLE_EQ(result[0], 2.5);
+    EXPECT_DOUBLE_EQ(result[1], -11.5);
+
+    result = (m_a - 1.0) / m_b * 2.0;
+    EXPECT_DOUBLE_EQ(result[2], 4.0);
+    result = -m_a;
+    EXPECT_DOUBLE_EQ(result[3], 16.0);
+}
+
+TEST_F(VectorExprTest, FunctionsAndWhere)
+{
+    Vector<double> roots = sqrt(abs(m_a));
+    EXPECT_DOUBLE_EQ(roots[1], 2.0);
+    EXPECT_DOUBLE_EQ(roots[3], 4.0);
+
+    Vector<double> selected = where(m_a > 0.0, m_a, m_b * 10.0);
+    EXPECT_DOUBLE_EQ(selected[0], 1.0);
+    EXPECT_DOUBLE_EQ(selected[1], 30.0);
+    EXPECT_DOUBLE_EQ(selected[2], 9.0);
+
+    Vector<int> clipped = {-5, 3, 12};
+    clipped = min(max(clipped, 0), 10);
+    EXPECT_EQ(clipped[0], 0);
+    EXPECT_EQ(clipped[1], 3);
+    EXPECT_EQ(clipped[2], 10);
+
+    Vector<bool> mask = m_a > 0.0 && m_b < 4.5;
+    EXPECT_TRUE(mask[0]);
+    EXPECT_FALSE(mask[3]);
+    EXPECT_DOUBLE_EQ(sum(where(mask, m_a, 0.0)), 10.0);
+}
+
+TEST_F(VectorExprTest, AssignToOperand)
+{
+    m_a = m_a * m_a + m_a;
+    EXPECT_DOUBLE_EQ(m_a[1], 12.0);
+
+    m_b += m_c;
+    m_b *= 2.0;
+    EXPECT_DOUBLE_EQ(m_b[0], 5.0);
+}
+
+TEST_F(VectorExprTest, SizeMismatchThrows)
+{
+    Vector<double> shorter = {1.0};
+    EXPECT_THROW(m_a + shorter, std::invalid_argument);
+}
+
+TEST_F(VectorExprTest, LargeParallelEvaluation)
+{
+    Vector<float> x;
+    x.resize(200000, 0.0f);
+    for (size_t i = 0; i < x.getSize(); ++i)
+    {
+        x[i] = static_cast<float>(i % 100);
+    }
+
+    Vector<float> y;
+    evaluate(y, x * 2.0f + 1.0f, 4);
+    ASSERT_EQ(y.getSize(), x.getSize());
+    for (size_t i = 0; i < y.getSize(); i += 1237)
+    {
+        ASSERT_FLOAT_EQ(y[i], static_cast<float>(i % 100) * 2.0f + 1.0f);
+    }
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <string>
 #include "../include/Vector.hpp" 
 
 class VectorTest : public ::testing::Test {
@@ -87,6 +88,69 @@ TEST_F(VectorTest, MoveAssignmentOperator)
     EXPECT_EQ(vec1.getCapacity(), 0);
 }
 
+TEST_F(VectorTest, CopyAssignmentReusesCapacity)
+{
+    Vector<std::string> vec1 = {"a", "b"};
+    Vector<std::string> vec2(8);
+    vec2.push_back("x");
+    vec2.push_back("y");
+    vec2.push_back("z");
+    const std::string* buffer = vec2.data();
+
+    vec2 = vec1;
+    EXPECT_EQ(vec2.data(), buffer);
+    EXPECT_EQ(vec2.getCapacity(), 8);
+    EXPECT_EQ(vec2.getSize(), 2);
+    EXPECT_EQ(vec2[1], "b");
+    EXPECT_TRUE(vec2.data()[2].empty());
+}
+
+TEST_F(VectorTest, CopyAllocatesOnlySize)
+{
+    Vector<int> vec1(100);
+    vec1.push_back(1);
+    vec1.push_back(2);
+
+    Vector<int> vec2(vec1);
+    EXPECT_EQ(vec2.getCapacity(), 2);
+
+    Vector<int> vec3;
+    vec3 = vec1;
+    EXPECT_EQ(vec3.getCapacity(), 2);
+    EXPECT_EQ(vec3[1], 2);
+}
+
+TEST_F(VectorTest, Assign)
+{
+    Vector<int> vec(10);
+    vec.assign(4, 7);
+    EXPECT_EQ(vec.getSize(), 4);
+    EXPECT_EQ(vec.getCapacity(), 10);
+    EXPECT_EQ(vec[3], 7);
+
+    vec.assign(20, 1);
+    EXPECT_EQ(vec.getSize(), 20);
+    EXPECT_EQ(vec.getCapacity(), 20);
+    EXPECT_EQ(vec[19], 1);
+}
+
+TEST_F(VectorTest, Swap)
+{
+    Vector<int> vec1 = {1, 2, 3};
+    Vector<int> vec2(16);
+    vec2.push_back(9);
+
+    vec1.swap(vec2);
+    EXPECT_EQ(vec1.getSize(), 1);
+    EXPECT_EQ(vec1.getCapacity(), 16);
+    EXPECT_EQ(vec2[2], 3);
+
+    swap(vec1, vec2);
+    EXPECT_EQ(vec1.getSize(), 3);
+    EXPECT_EQ(vec2[0], 9);
+    EXPECT_TRUE(noexcept(vec1.swap(vec2)));
+}
+
 // Test methods
 
 TEST_F(VectorTest, PushBack)
@@ -250,6 +314,22 @@ TEST_F(VectorTest, ShrinkToFit)
     EXPECT_EQ(vec.getCapacity(), 4);
 }
 
+TEST_F(VectorTest, ShrinkTo)
+{
+    Vector<int> vec = {1, 2, 3, 4 };
+    vec.reserve(10);
+    vec.shrink_to(6);
+    EXPECT_EQ(vec.getCapacity(), 6);
+    vec.shrink_to(8);
+    EXPECT_EQ(vec.getCapacity(), 6);
+    vec.shrink_to(2);
+    EXPECT_EQ(vec.getCapacity(), 4);
+    EXPECT_EQ(vec[3], 4);
+    vec.clear();
+    vec.shrink_to(0);
+    EXPECT_EQ(vec.getCapacity(), 0);
+}
+
 TEST_F(VectorTest, Insert)
 {
     Vector<int> vec = {1, 2, 3, 4 };
@@ -261,6 +341,56 @@ TEST_F(VectorTest, Insert)
     EXPECT_EQ(vec[3], 3);
 }
 
+TEST_F(VectorTest, InsertBatch)
+{
+    Vector<int> vec(16);
+    for (int i = 0; i < 5; ++i)
+    {
+        vec.push_back(i * 10);
+    }
+    const int* buffer = vec.data();
+
+    vec.insert_batch({{5, 50}, {0, -1}, {2, 15}, {2, 16}, {0, -2}});
+    int expected[] = {-1, -2, 0, 10, 15, 16, 20, 30, 40, 50};
+    ASSERT_EQ(vec.getSize(), 10);
+    EXPECT_EQ(vec.data(), buffer);
+    for (size_t i = 0; i < vec.getSize(); ++i)
+    {
+        EXPECT_EQ(vec[i], expected[i]);
+    }
+
+    EXPECT_THROW(vec.insert_batch({{1, 0}, {11, 0}}), std::out_of_range);
+    EXPECT_EQ(vec.getSize(), 10);
+}
+
+TEST_F(VectorTest, InsertBatchGrows)
+{
+    Vector<std::string> vec = {"b", "d"};
+    vec.insert_batch({{2, "e"}, {1, "c"}, {0, "a"}});
+    ASSERT_EQ(vec.getSize(), 5);
+    EXPECT_EQ(vec[0], "a");
+    EXPECT_EQ(vec[2], "c");
+    EXPECT_EQ(vec[4], "e");
+
+    vec.reserve(10);
+    vec.insert_batch({{3, "x"}});
+    EXPECT_EQ(vec[3], "x");
+    EXPECT_EQ(vec[4], "d");
+}
+
+TEST_F(VectorTest, ResizeForOverwrite)
+{
+    Vector<int> vec = {1, 2};
+    vec.resize_for_overwrite(5);
+    EXPECT_EQ(vec.getSize(), 5);
+    EXPECT_EQ(vec.getCapacity(), 5);
+    EXPECT_EQ(vec[1], 2);
+
+    vec.resize_for_overwrite(1);
+    EXPECT_EQ(vec.getSize(), 1);
+    EXPECT_EQ(vec.getCapacity(), 5);
+}
+
 TEST_F(VectorTest, Erase)
 {
     Vector<int> vec = {1, 2, 3, 4 };